@@ -20,10 +20,12 @@
 #define CepGen_Core_GeneratorWorker_h
 
 #include <memory>
+#include <mutex>
 
 #include "CepGen/Event/Event.h"
 
 namespace cepgen {
+  class EventExportPipeline;
   class Integrator;
   class RunParameters;
   class ProcessIntegrand;
@@ -43,6 +45,10 @@ namespace cepgen {
 
     void setRunParameters(const RunParameters*);  ///< Specify the runtime parameters
     void setIntegrator(const Integrator*);        ///< Specify the integrator instance handled by the mother generator
+    /// Specify the lock shared by all workers feeding the same events sink
+    inline void setStorageMutex(std::mutex* mutex) { storage_mutex_ = mutex; }
+    /// Specify the asynchronous pipeline the events are to be exported through (if null, events are exported in place)
+    inline void setExportPipeline(EventExportPipeline* pipeline) { export_pipeline_ = pipeline; }
 
     /// Launch the event generation
     /// \param[in] num_events Events multiplicity to generate
@@ -54,17 +60,26 @@ namespace cepgen {
     virtual void initialise() = 0;  ///< Initialise the generation parameters
     virtual bool next() = 0;        ///< Generate a single event
 
+    /// Serialise the generation parameters computed at initialisation (e.g. for their later reuse)
+    virtual std::vector<double> state() const { return {}; }
+    /// Restore generation parameters previously serialised with state(), to bypass their computation at initialisation
+    /// \return A boolean stating whether the state could be restored
+    virtual bool setState(const std::vector<double>&) { return false; }
+
   protected:
     /// Store the event in the output file
     /// \return A boolean stating whether the event was successfully saved
     bool storeEvent() const;
 
     // NOT owned
-    const Integrator* integrator_{nullptr};     ///< Pointer to the mother-handled integrator instance
-    const RunParameters* run_params_{nullptr};  ///< Steering parameters for the event generation
+    const Integrator* integrator_{nullptr};          ///< Pointer to the mother-handled integrator instance
+    const RunParameters* run_params_{nullptr};       ///< Steering parameters for the event generation
+    std::mutex* storage_mutex_{nullptr};             ///< Lock for the events sink, if shared among several workers
+    EventExportPipeline* export_pipeline_{nullptr};  ///< Asynchronous events export stage, if enabled
 
     std::unique_ptr<ProcessIntegrand> integrand_;                       ///< Local event weight evaluator
     std::function<void(const proc::Process&)> callback_proc_{nullptr};  ///< Callback function for each new event
+    size_t num_events_target_{0};  ///< Total number of events to be stored by all workers (0 if unbounded)
   };
 }  // namespace cepgen
 
@@ -19,6 +19,8 @@
 #ifndef CepGen_Core_RunParameters_h
 #define CepGen_Core_RunParameters_h
 
+#include <atomic>
+
 #include "CepGen/Physics/Kinematics.h"
 
 namespace cepgen {
@@ -103,6 +105,22 @@ namespace cepgen {
       inline size_t numThreads() const { return num_threads_; }    ///< Number of threads to perform event generation
       inline void setNumPoints(size_t np) { num_points_ = np; }    ///< Set number of points to probe in each integr.bin
       inline size_t numPoints() const { return num_points_; }  ///< Number of points to "shoot" in each integration bin
+      /// Set the directory where integration/generation grids are cached across runs (empty to disable)
+      inline void setGridCache(const std::string& path) { grid_cache_ = path; }
+      /// Directory where integration/generation grids are cached across runs (empty if disabled)
+      inline const std::string& gridCache() const { return grid_cache_; }
+      /// Set the number of events buffered for their asynchronous export (0 to export them synchronously)
+      inline void setExportBufferSize(size_t size) { export_buffer_size_ = size; }
+      /// Number of events buffered for their asynchronous export (0 if events are exported synchronously)
+      size_t exportBufferSize() const;
+      /// Policy to follow when the asynchronous export buffer is full
+      inline const std::string& exportBackpressure() const { return export_backpressure_; }
+      /// Set whether event modification algorithms are only run on events accepted by the unweighting
+      inline void setDeferModification(bool defer) { defer_modification_ = defer; }
+      /// Are event modification algorithms only run on events accepted by the unweighting?
+      inline bool deferModification() const { return defer_modification_; }
+      /// Maximal number of deferred event modification attempts for an accepted event
+      inline size_t modificationAttempts() const { return modification_attempts_; }
 
     private:
       int max_gen_;
@@ -111,6 +129,11 @@ namespace cepgen {
       bool symmetrise_;
       int num_threads_;
       int num_points_;
+      std::string grid_cache_;
+      int export_buffer_size_;
+      std::string export_backpressure_;
+      bool defer_modification_;
+      int modification_attempts_;
     };
     inline Generation& generation() { return generation_; }              ///< Event generation parameters
     inline const Generation& generation() const { return generation_; }  ///< Event generation parameters
@@ -154,15 +177,15 @@ namespace cepgen {
     inline unsigned int numGeneratedEvents() const { return num_gen_events_; }  ///< Number of events generated in run
 
   private:
-    std::unique_ptr<proc::Process> process_;    ///< Physics process held by these parameters
-    EventModifiersSequence evt_modifiers_;      ///< Collection of event modification algorithms to be applied
-    EventExportersSequence evt_exporters_;      ///< Collection of event output modules to be applied
-    TamingFunctionsSequence taming_functions_;  ///< Functions to be used to account for rescattering corrections
-    double total_gen_time_{0.};                 ///< Total generation time (in seconds)
-    unsigned long num_gen_events_{0ul};         ///< Number of events already generated
-    ParametersList integrator_;                 ///< Integrator parameters
-    Generation generation_;                     ///< Events generation parameters
-    std::unique_ptr<utils::TimeKeeper> timer_;  ///< Collection of stopwatches for timing
+    std::unique_ptr<proc::Process> process_;          ///< Physics process held by these parameters
+    EventModifiersSequence evt_modifiers_;            ///< Collection of event modification algorithms to be applied
+    EventExportersSequence evt_exporters_;            ///< Collection of event output modules to be applied
+    TamingFunctionsSequence taming_functions_;        ///< Functions to be used to account for rescattering corrections
+    double total_gen_time_{0.};                       ///< Total generation time (in seconds)
+    std::atomic<unsigned long> num_gen_events_{0ul};  ///< Number of events already generated
+    ParametersList integrator_;                       ///< Integrator parameters
+    Generation generation_;                           ///< Events generation parameters
+    std::unique_ptr<utils::TimeKeeper> timer_;        ///< Collection of stopwatches for timing
   };
 }  // namespace cepgen
 
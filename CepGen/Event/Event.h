@@ -125,10 +125,32 @@ namespace cepgen {
     ParticleRoles roles() const;
 
     /// Collection of key -> value pairs storing event metadata
-    struct EventMetadata : std::unordered_map<std::string, float> {
-      EventMetadata();
-      /// Retrieve the metadata value associated with a key
-      float operator()(const std::string& key) const { return count(key) > 0 ? at(key) : -1.; }
+    /// \note Keys are interned once in a global registry, values are stored in a table indexed by the interned key
+    class EventMetadata {
+    public:
+      EventMetadata();  ///< Build a collection with default values for the generator-filled fields
+
+      using Key = size_t;  ///< Interned metadata key
+      /// Interned keys for the fields filled by the generator core
+      enum : Key { GenerationTime = 0, TotalTime, Weight, AlphaEM, AlphaS };
+      static Key key(const std::string&);   ///< Interned key for a metadata field name (registered if not yet known)
+      static const std::string& name(Key);  ///< Metadata field name for an interned key
+
+      bool operator==(const EventMetadata&) const;                                        ///< Equality operator
+      inline bool operator!=(const EventMetadata& oth) const { return !(*this == oth); }  ///< Inequality operator
+
+      float& operator[](Key);  ///< Read-write access to a metadata value (created if not yet present)
+      /// Read-write access to a metadata value (created if not yet present)
+      inline float& operator[](const std::string& key) { return operator[](EventMetadata::key(key)); }
+      float operator()(Key) const;                 ///< Retrieve the metadata value associated with a key (or -1)
+      float operator()(const std::string&) const;  ///< Retrieve the metadata value associated with a key (or -1)
+      size_t count(const std::string&) const;      ///< Is a metadata field filled?
+      void clear();                                ///< Remove all metadata fields, keeping the storage allocated
+      std::vector<std::string> keys() const;       ///< List of all metadata fields filled
+
+    private:
+      std::vector<float> values_;  ///< Metadata values, indexed by interned key
+      std::vector<bool> filled_;   ///< Is a given metadata field filled?
     };
     /// List of auxiliary information
     EventMetadata metadata;
@@ -19,14 +19,52 @@
 #ifndef CepGen_Event_Particle_h
 #define CepGen_Event_Particle_h
 
-#include <set>
+#include <array>
+#include <iterator>
+#include <vector>
 
 #include "CepGen/Physics/Momentum.h"
 #include "CepGen/Physics/ParticleProperties.h"
-#include "CepGen/Utils/Hasher.h"
 
 namespace cepgen {
-  using ParticlesIds = std::set<int>;  ///< A set of integer-type particle identifiers
+  /// A sorted set of integer-type particle identifiers
+  /// \note Up to four identifiers (the typical parentage multiplicity) are stored inline, without heap allocation
+  class ParticlesIds {
+  public:
+    using value_type = int;
+    using iterator = const int*;
+    using const_iterator = iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = reverse_iterator;
+
+    ParticlesIds() = default;
+    ParticlesIds(std::initializer_list<int>);  ///< Build a set from a list of identifiers
+
+    bool operator==(const ParticlesIds&) const;                                        ///< Equality operator
+    inline bool operator!=(const ParticlesIds& oth) const { return !(*this == oth); }  ///< Inequality operator
+
+    /// Insert an identifier in the set
+    /// \return a pair of iterator to the identifier, and a flag stating if it was not present before insertion
+    std::pair<iterator, bool> insert(int);
+    size_t erase(int);         ///< Remove an identifier, and return the number of identifiers removed
+    void clear();              ///< Remove all identifiers, keeping the storage allocated
+    iterator find(int) const;  ///< Find an identifier in the set, or return the end iterator
+    inline size_t count(int id) const { return find(id) != end() ? 1 : 0; }  ///< Is an identifier in the set?
+
+    /// Number of identifiers in the set
+    inline size_t size() const { return overflow_.empty() ? num_inline_ : overflow_.size(); }
+    inline bool empty() const { return size() == 0; }  ///< Is the set empty?
+    inline iterator begin() const { return overflow_.empty() ? inline_.data() : overflow_.data(); }
+    inline iterator end() const { return begin() + size(); }
+    inline reverse_iterator rbegin() const { return reverse_iterator(end()); }
+    inline reverse_iterator rend() const { return reverse_iterator(begin()); }
+
+  private:
+    static constexpr size_t INLINE_SIZE = 4;  ///< Number of identifiers stored without heap allocation
+    std::array<int, INLINE_SIZE> inline_{};   ///< Inline storage for the identifiers
+    size_t num_inline_{0};                    ///< Number of identifiers in the inline storage
+    std::vector<int> overflow_;               ///< Heap-allocated storage once the inline capacity is exceeded
+  };
 
   /// Kinematic information for one particle
   class Particle {
@@ -134,13 +172,13 @@ namespace cepgen {
 
     // --- particle relations
 
-    inline bool primary() const { return mothers_.empty(); }    ///< Is this particle a primary particle?
-    Particle& addMother(Particle& mother_particle);             ///< Set the mother particle
-    inline ParticlesIds mothers() const { return mothers_; }    ///< Identifier to the mother particles
-    inline ParticlesIds& mothers() { return mothers_; }         ///< Identifier to the mother particles
-    Particle& addChild(Particle& child_particle);               ///< Add a decay product
-    inline ParticlesIds children() const { return children_; }  ///< Identifiers list of all child particles
-    inline ParticlesIds& children() { return children_; }       ///< Identifiers list of all child particles
+    inline bool primary() const { return mothers_.empty(); }           ///< Is this particle a primary particle?
+    Particle& addMother(Particle& mother_particle);                    ///< Set the mother particle
+    inline const ParticlesIds& mothers() const { return mothers_; }    ///< Identifier to the mother particles
+    inline ParticlesIds& mothers() { return mothers_; }                ///< Identifier to the mother particles
+    Particle& addChild(Particle& child_particle);                      ///< Add a decay product
+    inline const ParticlesIds& children() const { return children_; }  ///< Identifiers list of all child particles
+    inline ParticlesIds& children() { return children_; }              ///< Identifiers list of all child particles
 
     // --- global particle information extraction
 
@@ -166,12 +204,71 @@ namespace cepgen {
   using ParticleRoles = std::vector<Particle::Role>;     ///< List of particles' roles
 
   /// Map between a particle's role and its associated Particle object
-  class ParticlesMap : public std::unordered_map<Particle::Role, Particles, utils::EnumHash<Particle::Role> > {
+  /// \note Particles are stored in a fixed table indexed by role, whose buffers are kept allocated when cleared
+  class ParticlesMap {
   public:
-    ParticlesMap() = default;
+    using value_type = std::pair<const Particle::Role, Particles>;
+
+    ParticlesMap();
     ParticlesMap(const ParticlesMap&);             ///< Copy constructor
     ParticlesMap& operator=(const ParticlesMap&);  ///< Assignment operator
     ~ParticlesMap() = default;
+
+    bool operator==(const ParticlesMap&) const;                                        ///< Equality operator
+    inline bool operator!=(const ParticlesMap& oth) const { return !(*this == oth); }  ///< Inequality operator
+
+    Particles& operator[](Particle::Role);             ///< Particles with a given role (created if not yet present)
+    Particles& at(Particle::Role);                     ///< Particles with a given (existing) role
+    const Particles& at(Particle::Role) const;         ///< Particles with a given (existing) role
+    size_t count(Particle::Role) const;                ///< Is a given role present in the map?
+    size_t erase(Particle::Role);                      ///< Remove a role from the map
+    void clear();                                      ///< Remove all roles, keeping the particles buffers allocated
+    size_t size() const;                               ///< Number of roles present in the map
+    inline bool empty() const { return size() == 0; }  ///< Is the map empty?
+
+    /// Iterator over the roles present in the map
+    template <typename M, typename V>
+    class Iterator {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = ParticlesMap::value_type;
+      using difference_type = std::ptrdiff_t;
+      using pointer = V*;
+      using reference = V&;
+
+      explicit Iterator(M* map, size_t index) : map_(map), index_(index) { skip(); }
+
+      inline reference operator*() const { return map_->particles_[index_]; }
+      inline pointer operator->() const { return &map_->particles_[index_]; }
+      inline Iterator& operator++() {
+        ++index_;
+        skip();
+        return *this;
+      }
+      inline bool operator==(const Iterator& oth) const { return index_ == oth.index_; }
+      inline bool operator!=(const Iterator& oth) const { return index_ != oth.index_; }
+
+    private:
+      inline void skip() {
+        while (index_ < NUM_ROLES && !map_->filled_[index_])
+          ++index_;
+      }
+      M* map_{nullptr};
+      size_t index_{0};
+    };
+    using iterator = Iterator<ParticlesMap, value_type>;
+    using const_iterator = Iterator<const ParticlesMap, const value_type>;
+
+    inline iterator begin() { return iterator(this, 0); }
+    inline iterator end() { return iterator(this, NUM_ROLES); }
+    inline const_iterator begin() const { return const_iterator(this, 0); }
+    inline const_iterator end() const { return const_iterator(this, NUM_ROLES); }
+
+  private:
+    static constexpr size_t NUM_ROLES = 9;  ///< Number of roles defined in Particle::Role
+    static size_t index(Particle::Role);    ///< Table index for a given role
+    std::array<value_type, NUM_ROLES> particles_;
+    std::array<bool, NUM_ROLES> filled_{};  ///< Is a given role present in the map?
   };
 }  // namespace cepgen
 
@@ -31,17 +31,75 @@ namespace cepgen::utils {
   /// \author Laurent Forthomme <laurent.forthomme@cern.ch>
   /// \date Jul 2019
   class EventBrowser {
+  private:
+    typedef double (Momentum::*pMethod)() const;
+    typedef double (Momentum::*pMethodOth)(const Momentum&) const;
+
   public:
     EventBrowser() = default;
+
+    /// Precompiled accessor to an event variable
+    /// \note The variable expression is parsed only once, at construction; the accessor can then be evaluated for
+    ///  any number of events without string parsing, map lookups, or memory allocation.
+    class Accessor {
+    public:
+      double operator()(const Event&) const;                    ///< Evaluate the variable for one event
+      inline const std::string& name() const { return name_; }  ///< Variable expression
+
+    private:
+      friend class EventBrowser;
+      explicit Accessor(const std::string& name) : name_(name) {}
+
+      /// Rule to select a particle in the event
+      struct Selector {
+        const Particle& operator()(const Event&) const;    ///< Retrieve the particle from the event
+        bool by_role{false};                               ///< Is the particle selected by its role (or by its id)?
+        int id{0};                                         ///< Particle identifier in the event
+        Particle::Role role{Particle::Role::UnknownRole};  ///< Particle role in the event
+      };
+      enum class Quantity {
+        invalid,
+        momentum,
+        xi,
+        pdg,
+        charge,
+        status,
+        twoMomenta,
+        momentaSum,
+        acoplanarity,
+        numParticles,
+        numStableOutgoingBeam1,
+        numStableOutgoingBeam2,
+        missingEnergy,
+        missingEnergyPhi,
+        cmEnergy,
+        metadata
+      };
+
+      std::string name_;                        ///< Variable expression
+      Quantity quantity_{Quantity::invalid};    ///< Type of quantity to compute
+      Selector particle1_, particle2_;          ///< Particle(s) selection rules
+      pMethod momentum_method_{nullptr};        ///< Single-momentum getter
+      pMethodOth two_momenta_method_{nullptr};  ///< Two-momenta getter
+      size_t metadata_key_{0};                  ///< Interned event metadata field key
+    };
+
     double get(const Event& event, const std::string& variable_name) const;  ///< Get/compute a variable value
 
+    Accessor compile(const std::string& variable_name) const;  ///< Resolve a variable expression into an accessor
+    /// Resolve a collection of variable expressions into accessors
+    std::vector<Accessor> compile(const std::vector<std::string>& variables_names) const;
+    /// Evaluate a collection of precompiled accessors for one event
+    /// \param[out] values Variables values (resized to the accessors multiplicity)
+    static void get(const Event& event, const std::vector<Accessor>& accessors, std::vector<double>& values);
+    /// Evaluate a collection of precompiled accessors for a batch of events
+    /// \param[out] values Variables values, with accessors.size() consecutive values per event
+    static void get(const std::vector<Event>& events,
+                    const std::vector<Accessor>& accessors,
+                    std::vector<double>& values);
+
   private:
-    double variable(const Event&, const Particle&, const std::string&) const;  ///< Retrieve a particle variable
-    double variable(const Event&,
-                    const Particle&,
-                    const Particle&,
-                    const std::string&) const;                 ///< Retrieve a two-particle variable
-    static double variable(const Event&, const std::string&);  ///< Retrieve a whole event variable
+    Accessor::Selector selector(const std::string&, const std::string& variable) const;  ///< Build a particle selector
 
     static const std::regex rgx_select_id_;
     static const std::regex rgx_select_id2_;
@@ -58,7 +116,6 @@ namespace cepgen::utils {
                                                                        {"pa2", Particle::Role::Parton2},
                                                                        {"cs", Particle::Role::CentralSystem},
                                                                        {"int", Particle::Role::Intermediate}};
-    typedef double (Momentum::*pMethod)() const;
     /// Mapping of string variables to momentum getter methods
     const std::unordered_map<std::string, pMethod> m_mom_str_ = {
         {"px", &Momentum::px},        {"py", &Momentum::py},      {"pz", &Momentum::pz},
@@ -69,7 +126,7 @@ namespace cepgen::utils {
         {"p", &Momentum::p},          {"p2", &Momentum::p2},      {"th", &Momentum::theta},
         {"y", &Momentum::rapidity},   {"beta", &Momentum::beta},  {"gamma", &Momentum::gamma},
         {"gamma2", &Momentum::gamma2}};
-    typedef double (Momentum::*pMethodOth)(const Momentum&) const;
+    /// Mapping of string variables to two-momenta getter methods
     const std::unordered_map<std::string, pMethodOth> m_two_mom_str_ = {{"deta", &Momentum::deltaEta},
                                                                         {"dphi", &Momentum::deltaPhi},
                                                                         {"dpt", &Momentum::deltaPt},
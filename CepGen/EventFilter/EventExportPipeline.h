@@ -0,0 +1,94 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_EventFilter_EventExportPipeline_h
+#define CepGen_EventFilter_EventExportPipeline_h
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "CepGen/Event/Event.h"
+
+namespace cepgen {
+  class EventExporter;
+  /// Asynchronous events export stage, decoupling the events storage from their generation
+  /// \note Events are copied into a bounded ring buffer by a single producer (the generator workers, serialised by
+  ///  their storage lock), and each exporter is fed by its own background thread, in the events generation order.
+  ///  A buffer slot is reused once all exporters have processed its event. As events are exported after their
+  ///  storage, an event rejected by an exporter (unlike in the synchronous export mode) cannot be replaced by a newly
+  ///  generated one: such failures are only counted, and reported when the pipeline is released.
+  class EventExportPipeline {
+  public:
+    /// Policy to follow when the buffer is full
+    enum class Backpressure {
+      block,  ///< wait for a buffer slot to be released by the slowest exporter
+      drop    ///< discard the event
+    };
+    /// Build an export pipeline for a collection of exporters
+    /// \param[in] exporters Events exporters (NOT owned), which must outlive this pipeline
+    /// \param[in] capacity Maximal number of events buffered
+    /// \param[in] backpressure Policy to follow when the buffer is full
+    explicit EventExportPipeline(const std::vector<EventExporter*>& exporters,
+                                 size_t capacity,
+                                 Backpressure backpressure = Backpressure::block);
+    ~EventExportPipeline();  ///< Export all events still buffered, and stop the export threads
+
+    /// Queue an event for its export
+    /// \note Only one thread may push events at a time
+    /// \return A boolean stating whether the event was queued (or dropped due to the backpressure policy)
+    bool push(const Event&);
+    /// Wait for all queued events to be exported
+    /// \note Any exception raised by an exporter is propagated to the caller
+    void flush();
+
+    inline size_t capacity() const { return slots_.size(); }          ///< Maximal number of events buffered
+    inline size_t numQueued() const { return head_.load(); }          ///< Number of events queued since start
+    inline size_t numDropped() const { return num_dropped_.load(); }  ///< Number of events discarded by the policy
+    inline size_t numFailed() const { return num_failed_.load(); }    ///< Number of events rejected by an exporter
+
+  private:
+    /// Background thread feeding one exporter
+    struct Consumer {
+      EventExporter* exporter{nullptr};  ///< Events exporter (NOT owned)
+      std::atomic<size_t> tail{0};       ///< Index of the next event to be exported
+      std::thread thread;                ///< Export thread
+    };
+    void consume(Consumer&);                ///< Export loop for one consumer
+    size_t minimumTail() const;             ///< Index of the oldest event still being exported
+    void notify(std::condition_variable&);  ///< Wake up all threads waiting on a condition
+
+    const Backpressure backpressure_;                    ///< Policy to follow when the buffer is full
+    std::vector<Event> slots_;                           ///< Ring buffer of events to be exported
+    std::vector<std::unique_ptr<Consumer> > consumers_;  ///< Export threads, one per exporter
+    std::atomic<size_t> head_{0};                        ///< Index of the next event to be queued
+    std::atomic<bool> stop_{false};                      ///< Have the export threads to be stopped?
+    std::atomic<size_t> num_dropped_{0}, num_failed_{0};
+    std::mutex mutex_;                       ///< Lock for the idle threads to wait on a buffer update
+    std::condition_variable event_queued_;   ///< Notified when an event is queued, or the pipeline is stopped
+    std::condition_variable slot_released_;  ///< Notified when an event was processed by an exporter
+    std::mutex exception_mutex_;
+    std::exception_ptr exception_;  ///< First exception raised by an exporter
+  };
+}  // namespace cepgen
+
+#endif
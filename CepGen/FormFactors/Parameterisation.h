@@ -19,6 +19,8 @@
 #ifndef CepGen_FormFactors_Parameterisation_h
 #define CepGen_FormFactors_Parameterisation_h
 
+#include <mutex>
+
 #include "CepGen/FormFactors/FormFactors.h"
 #include "CepGen/Modules/NamedModule.h"
 #include "CepGen/Physics/ParticleProperties.h"
@@ -39,13 +41,26 @@ namespace cepgen::formfac {
     inline virtual bool fragmenting() const { return false; }  ///< Will the nucleon survive the exchange?
     pdgid_t pdgId() const { return pdg_id_; }                  ///< Incoming particle's PDG identifier
 
+    /// Thread-safe computation of all form factors for a given \f$Q^2\f$ value
+    /// \note Unlike the call operator, this evaluation may be called concurrently from several threads on a single
+    ///  instance
+    FormFactors evaluate(double q2) const;
+
   protected:
     static constexpr double MU = 2.792847337;  ///< Proton magnetic moment
 
-    virtual void eval() = 0;  ///< Local form factors evaluation method
+    /// Local (stateful) form factors evaluation method
+    /// \note The default implementation forwards the computation to the stateless compute() method
+    virtual void eval();
+    /// Stateless computation of all form factors for a given \f$Q^2\f$ value
+    /// \note The default implementation serialises the calls to the stateful eval() method. Reentrant
+    ///  parameterisations are expected to override it (and only it).
+    virtual FormFactors compute(double q2) const;
 
-    void setFEFM(double fe, double fm);  ///< Set the electromagnetic form factors
-    void setGEGM(double ge, double gm);  ///< Set the Sachs form factors
+    void setFEFM(double fe, double fm);                           ///< Set the electromagnetic form factors
+    void setGEGM(double ge, double gm);                           ///< Set the Sachs form factors
+    FormFactors fromFEFM(double q2, double fe, double fm) const;  ///< Form factors from electromagnetic form factors
+    FormFactors fromGEGM(double q2, double ge, double gm) const;  ///< Form factors from Sachs form factors
 
     const pdgid_t pdg_id_;  ///< Incoming beam
     const double mass2_;    ///< Incoming beam squared mass
@@ -54,6 +69,10 @@ namespace cepgen::formfac {
 
     double q2_{-1.};    ///< Virtuality at which the form factors are evaluated
     FormFactors ff_{};  ///< Last form factors computed
+
+  private:
+    mutable std::mutex eval_mutex_;  ///< Serialisation of the stateful evaluations
+    bool in_eval_{false};            ///< Is a serialised stateful evaluation ongoing?
   };
   std::ostream& operator<<(std::ostream&, const FormFactors&);
 }  // namespace cepgen::formfac
@@ -19,14 +19,17 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "CepGen/Utils/Value.h"
 
 /// Common namespace for this Monte Carlo generator
 namespace cepgen {
   class Event;
+  class EventExportPipeline;
   class Integrator;
   class GeneratorWorker;
+  class GridCache;
   class RunParameters;
 }  // namespace cepgen
 namespace cepgen::proc {
@@ -89,10 +92,17 @@ namespace cepgen {
     void initialise();       ///< Initialise event generation
     void clearRun();         ///< Remove all references to a previous generation/run
     void resetIntegrator();  ///< Reset integrator algorithm from the user-specified configuration
+    /// Build a generator worker from the user-specified configuration
+    /// \param[in] thread_id Worker index, used to decorrelate the random number streams of concurrent workers
+    std::unique_ptr<GeneratorWorker> buildWorker(size_t thread_id = 0) const;
 
     std::unique_ptr<RunParameters> parameters_;  ///< Run parameters for event generation and cross-section computation
     std::unique_ptr<GeneratorWorker> worker_;    ///< Generator worker instance
+    std::vector<std::unique_ptr<GeneratorWorker> > secondary_workers_;  ///< Additional workers for multithreading
     std::unique_ptr<Integrator> integrator_;     ///< Integration algorithm
+    std::unique_ptr<GridCache> grid_cache_;      ///< On-disk persistency of the integration/generation grids
+    /// Asynchronous events export stage (if enabled), to be released before the run parameters
+    std::unique_ptr<EventExportPipeline> export_pipeline_;
     bool initialised_{false};                    ///< Has the event generator already been initialised?
     Value cross_section_{-1., -1.};              ///< Cross-section value computed at the last integration
   };
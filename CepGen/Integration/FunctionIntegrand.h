@@ -31,6 +31,8 @@ namespace cepgen {
 
     double eval(const std::vector<double>&) override;
     size_t size() const override { return num_dimensions_; }
+    /// \note The wrapped function (and any state it captures) is shared with the clone
+    std::unique_ptr<Integrand> clone() const override { return std::make_unique<FunctionIntegrand>(*this); }
 
   private:
     const std::function<double(const std::vector<double>&)> function_{};
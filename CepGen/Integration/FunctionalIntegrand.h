@@ -34,8 +34,11 @@ namespace cepgen {
 
     double eval(const std::vector<double>&) override;
     size_t size() const override;
+    std::unique_ptr<Integrand> clone() const override;
 
   private:
+    FunctionalIntegrand(const FunctionalIntegrand&);  ///< Build an independent functional evaluator from another one
+
     std::unique_ptr<utils::Functional> functional_;
   };
 }  // namespace cepgen
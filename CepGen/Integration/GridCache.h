@@ -0,0 +1,71 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_Integration_GridCache_h
+#define CepGen_Integration_GridCache_h
+
+#include <string>
+#include <vector>
+
+#include "CepGen/Utils/Value.h"
+
+namespace cepgen {
+  class RunParameters;
+}  // namespace cepgen
+
+namespace cepgen {
+  /// On-disk persistency of the integration and generation grids across runs
+  /// \note Cache files are indexed by a hash of the run configuration parts affecting the integrand and the grids, so
+  ///  that all jobs sharing a physics configuration (but e.g. not their output or random seeds) share the same grids.
+  class GridCache {
+  public:
+    /// Build a cache handler for a run configuration
+    /// \param[in] path Directory where the cached grids are stored
+    /// \param[in] run_parameters Run configuration to retrieve or store the grids for
+    explicit GridCache(const std::string& path, const RunParameters& run_parameters);
+
+    bool load();         ///< Retrieve the grids cached for this run configuration, if any
+    void store() const;  ///< Store the grids into the cache
+
+    inline const std::string& filename() const { return filename_; }  ///< Path to the cache file
+
+    inline const Value& crossSection() const { return cross_section_; }  ///< Cross-section computed, in pb
+    inline void setCrossSection(const Value& cross_section) { cross_section_ = cross_section; }  ///< Set cross-section
+    /// Adapted integrator state (e.g. Vegas grid)
+    inline const std::vector<double>& integratorState() const { return integrator_state_; }
+    /// Set the adapted integrator state
+    inline void setIntegratorState(const std::vector<double>& state) { integrator_state_ = state; }
+    /// Generator worker state (e.g. maxima of the function in each generation grid bin)
+    inline const std::vector<double>& workerState() const { return worker_state_; }
+    /// Set the generator worker state
+    inline void setWorkerState(const std::vector<double>& state) { worker_state_ = state; }
+
+  private:
+    /// Serialise all run configuration parts affecting the integrand and the grids
+    static std::string configuration(const RunParameters&);
+
+    const std::string path_;                ///< Cache directory
+    const std::string configuration_;       ///< Serialised run configuration
+    const std::string filename_;            ///< Path to the cache file for this run configuration
+    Value cross_section_{-1., -1.};         ///< Cross-section computed for this run configuration
+    std::vector<double> integrator_state_;  ///< Serialised integrator state
+    std::vector<double> worker_state_;      ///< Serialised generator worker state
+  };
+}  // namespace cepgen
+
+#endif
@@ -19,6 +19,8 @@
 #ifndef CepGen_Integration_GridParameters_h
 #define CepGen_Integration_GridParameters_h
 
+#include <cstdint>
+#include <limits>
 #include <vector>
 
 namespace cepgen::utils {
@@ -27,19 +29,27 @@ namespace cepgen::utils {
 
 namespace cepgen {
   /// A parameters placeholder for the grid integration helper
+  /// \note Bins coordinates are not stored, but decoded on-the-fly from the flat bin index, as the
+  ///  binSize^ndim-long coordinates table becomes prohibitively large for high-dimensional phase spaces
   class GridParameters {
   public:
     /// Build a generation grid for a ndim-dimensional phase space
-    explicit GridParameters(size_t m_bin, size_t num_dimensions);
+    /// \param[in] max_memory Maximal memory (in bytes) allowed for the per-bin counters and maxima
+    explicit GridParameters(size_t m_bin, size_t num_dimensions, size_t max_memory = kDefaultMaxMemory);
+
+    static constexpr size_t kDefaultMaxMemory = 4ull << 30;  ///< Default per-bin tables memory budget (4 GiB)
+    static constexpr size_t kBinMemory = sizeof(uint32_t) + sizeof(float);  ///< Memory footprint of one bin
 
     using coord_t = std::vector<unsigned short>;  ///< Coordinates definition
 
     void dump() const;  ///< Dump the grid coordinates
 
-    inline size_t size() const { return coordinates_.size(); }  ///< Grid multiplicity
-    /// Number of times a phase space point has been randomly selected
-    inline const coord_t& n(size_t coord) const { return coordinates_.at(coord); }
-    inline float globalMax() const { return f_max_global_; }  ///< Global function maximum
+    inline size_t size() const { return f_max_.size(); }             ///< Grid multiplicity
+    inline size_t numDimensions() const { return num_dimensions_; }  ///< Phase space multiplicity
+    coord_t n(size_t coord) const;                                   ///< Coordinates of a grid bin
+    inline float globalMax() const { return f_max_global_; }         ///< Global function maximum
+    /// Packed collection of maximal function values for all grid coordinates
+    inline const std::vector<float>& maxValues() const { return f_max_; }
 
     /// Maximal function value for a given grid coordinate
     inline float maxValue(size_t coord) const { return f_max_.at(coord); }
@@ -49,10 +59,24 @@ namespace cepgen {
     void setValue(size_t, float);  ///< Set the function value for a given grid coordinate
     /// Shoot a phase space point for a grid coordinate
     void shoot(utils::RandomGenerator& random_generator, size_t coordinate, std::vector<double>& out) const;
+    /// Shoot a batch of phase space points for a grid coordinate
+    /// \param[out] out Flattened collection of coordinates sets, with the grid dimension coordinates for each point
+    void shoot(utils::RandomGenerator& random_generator,
+               size_t coordinate,
+               size_t num_points,
+               std::vector<double>& out) const;
     /// Number of points already shot for a given grid coordinate
     inline size_t numPoints(size_t coordinate) const { return num_points_.at(coordinate); }
     /// Specify a new trial has been attempted for bin
-    inline void increment(size_t coordinate) { num_points_.at(coordinate)++; }
+    /// \note The counter saturates instead of wrapping around
+    inline void increment(size_t coordinate) {
+      if (auto& num_points = num_points_.at(coordinate); num_points < std::numeric_limits<uint32_t>::max())
+        ++num_points;
+    }
+
+    /// Specify whether bins are selected in proportion to their function maximum (instead of uniformly)
+    /// \note This modifies the normalisation of the number of events missed in a bin whose maximum is raised
+    inline void setProportionalSelection(bool proportional = true) { proportional_selection_ = proportional; }
 
     inline bool prepared() const { return gen_prepared_; }                       ///< Has the grid been prepared?
     inline void setPrepared(bool prepared = true) { gen_prepared_ = prepared; }  ///< Mark the grid as prepared
@@ -67,18 +91,16 @@ namespace cepgen {
     void initCorrectionCycle(size_t, float);
 
   private:
-    void generateCoordinates(coord_t&, size_t) const;
-
-    const size_t mbin_;         ///< Integration grid size parameter
-    const double inv_mbin_;     ///< Weight of each grid coordinate
-    size_t num_dimensions_{0};  ///< Phase space multiplicity
-    bool gen_prepared_{false};  ///< Has the grid been already prepared?
-    float correction_{0.};      ///< Correction to apply on the next phase space point generation
+    const size_t mbin_;                   ///< Integration grid size parameter
+    const double inv_mbin_;               ///< Weight of each grid coordinate
+    size_t num_dimensions_{0};            ///< Phase space multiplicity
+    bool gen_prepared_{false};            ///< Has the grid been already prepared?
+    bool proportional_selection_{false};  ///< Are bins selected in proportion to their function maximum?
+    float correction_{0.};                ///< Correction to apply on the next phase space point generation
     float correction2_{0.};
-    std::vector<coord_t> coordinates_;  ///< Point coordinates in grid
-    std::vector<size_t> num_points_;    ///< Number of functions values evaluated for this point
+    std::vector<uint32_t> num_points_;  ///< Number of functions values evaluated for this point
     std::vector<float> f_max_;          ///< Maximal value of the function at one given point
-    float f_max_global_{0.};            ///< Maximal value of the function in the considered integration range
+    float f_max_global_{0.};          ///< Maximal value of the function in the considered integration range
     float f_max2_{0.};
     float f_max_diff_{0.};
     float f_max_old_{0.};
@@ -19,6 +19,7 @@
 #ifndef CepGen_Integration_Integrand_h
 #define CepGen_Integration_Integrand_h
 
+#include <memory>
 #include <vector>
 
 namespace cepgen {
@@ -29,8 +30,14 @@ namespace cepgen {
     virtual ~Integrand() = default;
 
     virtual double eval(const std::vector<double>&) = 0;  ///< Compute the integrand for a given coordinates set
-    virtual size_t size() const = 0;                      ///< Phase space dimension
-    virtual bool hasProcess() const { return false; }     ///< Does this integrand also contain a process object?
+    /// Compute the integrand for a batch of coordinates sets
+    /// \param[in] points Flattened collection of coordinates sets, with size() coordinates for each point
+    /// \param[out] weights Integrand values for all points, in the same order as the input coordinates sets
+    virtual void evalBatch(const std::vector<double>& points, std::vector<double>& weights);
+    virtual size_t size() const = 0;                   ///< Phase space dimension
+    virtual bool hasProcess() const { return false; }  ///< Does this integrand also contain a process object?
+    /// Build an independent copy of this integrand, e.g. to be evaluated in another thread
+    virtual std::unique_ptr<Integrand> clone() const;
   };
 }  // namespace cepgen
 
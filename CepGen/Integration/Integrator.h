@@ -39,6 +39,26 @@ namespace cepgen {
 
     virtual bool oneDimensional() const { return false; }  ///< Is the integrator designed for one-dimensional case?
     virtual double eval(Integrand&, const std::vector<double>&) const;  ///< Compute function value at one point
+    /// Map a batch of points from the unit hypercube onto the integrator-adapted phase space (e.g. an importance
+    ///  sampling grid); by default, the identity mapping
+    /// \param[in] ndim Phase space dimension
+    /// \param[in] points Flattened collection of coordinates sets, with ndim coordinates for each point
+    /// \param[out] treated_points Flattened collection of mapped coordinates sets
+    /// \param[out] jacobians Jacobian of the mapping for each point
+    virtual void treat(size_t ndim,
+                       const std::vector<double>& points,
+                       std::vector<double>& treated_points,
+                       std::vector<double>& jacobians) const;
+    /// Compute the function values for a batch of points, mapped through the integrator-adapted phase space
+    /// \param[in] points Flattened collection of coordinates sets in the unit hypercube
+    /// \param[out] weights Function values (including the mapping Jacobian) for all points
+    void evalBatch(Integrand&, const std::vector<double>& points, std::vector<double>& weights) const;
+
+    /// Serialise the adapted integrator state (e.g. an importance sampling grid) for its later reuse
+    virtual std::vector<double> state() const { return {}; }
+    /// Restore an integrator state previously serialised with state()
+    /// \return A boolean stating whether the state could be restored
+    virtual bool setState(const std::vector<double>& state) { return state.empty(); }
 
     /// Evaluate the integral for a given range
     Value integrate(Integrand& integrand, const std::vector<Limits>& = {});
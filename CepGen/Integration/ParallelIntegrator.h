@@ -0,0 +1,97 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_Integration_ParallelIntegrator_h
+#define CepGen_Integration_ParallelIntegrator_h
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "CepGen/Integration/Integrator.h"
+
+namespace cepgen::utils {
+  class RandomGenerator;
+}  // namespace cepgen::utils
+
+namespace cepgen {
+  /// Base integration algorithm evaluating its integrand over batches of points spread among several threads
+  /// \note Random coordinates are drawn sequentially, and partial results summed in the order of the points batch,
+  ///  so that the integration result only depends on the random numbers generator seed. Evaluation threads are kept
+  ///  alive (and idle between two batches) for the whole integrator lifetime.
+  class ParallelIntegrator : public Integrator {
+  public:
+    explicit ParallelIntegrator(const ParametersList&);
+    ~ParallelIntegrator() override;
+
+    static ParametersDescription description();
+
+  protected:
+    /// Prepare the pool of integrands for a new integration
+    /// \param[in] integrand Integrand to be evaluated by the first thread, and cloned for all other threads
+    /// \param[in] range Integration range for all variables
+    void prepare(Integrand& integrand, const std::vector<Limits>& range);
+    /// Draw a batch of points uniformly distributed in a sub-range of the integration range
+    /// \param[in] num_points Number of points to generate
+    /// \param[in] x_low Lower bounds of the sub-range
+    /// \param[in] x_high Upper bounds of the sub-range
+    /// \param[out] points Flattened list of coordinates
+    void shoot(size_t num_points,
+               const std::vector<double>& x_low,
+               const std::vector<double>& x_high,
+               std::vector<double>& points) const;
+    /// Evaluate the integrand over a batch of points, split among all threads
+    /// \param[in] points Flattened list of coordinates, with ndim() coordinates per point
+    /// \param[out] weights Integrand values for all points
+    void evalBatch(const std::vector<double>& points, std::vector<double>& weights);
+    inline size_t ndim() const { return x_low_.size(); }  ///< Integration phase space dimension
+    inline size_t numThreads() const { return integrands_.size(); }  ///< Number of integrand evaluation threads
+
+    const std::unique_ptr<utils::RandomGenerator> random_generator_;  ///< Random number generator for points sampling
+    const size_t batch_size_;                                         ///< Maximal number of points in a batch
+    std::vector<double> x_low_;                                       ///< Lower bounds to all integration variables
+    std::vector<double> x_high_;                                      ///< Upper bounds to all integration variables
+
+  private:
+    void startWorkers();  ///< Launch the evaluation threads for all integrands beyond the first one
+    void stopWorkers();   ///< Stop and join all evaluation threads
+    /// Evaluation loop of one thread, waiting for its points batches
+    /// \param[in] thread_id Index of the integrand evaluated by this thread
+    /// \param[in] last_batch_id Identifier of the last batch dispatched before the thread was launched
+    void workerLoop(size_t thread_id, size_t last_batch_id);
+
+    const int num_threads_;                             ///< User-steered number of threads
+    std::vector<Integrand*> integrands_;                ///< Integrands evaluated in each thread (NOT owned)
+    std::vector<std::unique_ptr<Integrand> > clones_;   ///< Integrand clones for additional threads
+    std::vector<std::vector<double> > thread_points_;   ///< Coordinates batch for each thread
+    std::vector<std::vector<double> > thread_weights_;  ///< Integrand values batch for each thread
+    std::vector<std::exception_ptr> thread_errors_;     ///< Exception raised while evaluating each thread batch
+    std::vector<std::thread> workers_;                  ///< Persistent evaluation threads (all but the first one)
+    std::mutex pool_mutex_;                             ///< Protection of the threads pool synchronisation state
+    std::condition_variable batch_ready_;               ///< Notification of a new batch to all evaluation threads
+    std::condition_variable batch_done_;                ///< Notification of the batch evaluation completion
+    size_t batch_id_{0};                                ///< Identifier of the batch being evaluated
+    size_t num_chunks_{0};                              ///< Number of threads involved in the current batch
+    size_t num_pending_chunks_{0};                      ///< Number of chunks still being evaluated by the pool
+    bool stop_workers_{false};                          ///< Request for all evaluation threads to stop
+  };
+}  // namespace cepgen
+
+#endif
@@ -21,18 +21,22 @@
 
 #include <memory>
 
+#include "CepGen/Event/Event.h"
 #include "CepGen/EventFilter/EventBrowser.h"
 #include "CepGen/Integration/Integrand.h"
 
 namespace cepgen {
+  class EventModifier;
   class RunParameters;
-}
+  class Value;
+}  // namespace cepgen
 namespace cepgen::proc {
   class Process;
 }
 namespace cepgen::utils {
+  class Functional;
   class Timer;
-}
+}  // namespace cepgen::utils
 
 namespace cepgen {
   /// Wrapper to the function to be integrated
@@ -40,6 +44,7 @@ namespace cepgen {
   public:
     explicit ProcessIntegrand(const proc::Process&);
     explicit ProcessIntegrand(const RunParameters*);
+    ~ProcessIntegrand() override;
 
     /// Compute the integrand for a given phase space point (or “event”)
     /// \param[in] x Phase space point coordinates
@@ -50,6 +55,8 @@ namespace cepgen {
     double eval(const std::vector<double>& x) override;
     size_t size() const override;  ///< Phase space dimension
     bool hasProcess() const override { return true; }
+    /// Build an integrand holding its own clone of the physics process
+    std::unique_ptr<Integrand> clone() const override;
 
     proc::Process& process();              ///< Thread-local physics process
     const proc::Process& process() const;  ///< Thread-local physics process
@@ -57,14 +64,45 @@ namespace cepgen {
     void setStorage(bool store) { storage_ = store; }  ///< Specify if the generated events will be stored
     bool storage() const { return storage_; }          ///< Store the events generated in this run?
 
+    /// Defer the event modification algorithms to an explicit modifyEvent() call (e.g. once the event is accepted)
+    /// \note In this mode, all kinematic cuts are applied on the event before its modification
+    void setDeferredModification(bool deferred) { deferred_modification_ = deferred; }
+    bool deferredModification() const { return deferred_modification_; }  ///< Are event modifications deferred?
+    /// Run the deferred event modification algorithms on the last event evaluated
+    /// \param[in] num_attempts Maximal number of attempts if the event is vetoed by a modification algorithm
+    /// \return Branching fraction to be applied to the event weight, or 0 if the event was vetoed at all attempts
+    double modifyEvent(size_t num_attempts = 1);
+
+    /// Use private copies of the event modification algorithms and taming functions, rebuilt from their parameters
+    /// \note These modules are not reentrant; each integrand evaluated concurrently to others requires its own copies.
+    ///  The copies are only built at their first use.
+    void useLocalModules() { local_modules_ = true; }
+    void setCrossSection(const Value&);  ///< Feed the cross-section to the private event modification algorithms
+
   private:
     void setProcess(const proc::Process&);
+    /// Event modification algorithms to be run on the events (private copies, or shared with the run parameters)
+    const std::vector<std::unique_ptr<EventModifier> >& eventModifiers();
+    /// Taming functions to be applied on the events (private copies, or shared with the run parameters)
+    const std::vector<std::unique_ptr<utils::Functional> >& tamingFunctions();
 
-    std::unique_ptr<proc::Process> process_;        ///< Local instance of the physics process
-    const RunParameters* run_parameters_{nullptr};  ///< Generator-owned runtime parameters
-    const std::unique_ptr<utils::Timer> timer_;     ///< Timekeeper for event generation
-    utils::EventBrowser bws_;                       ///< Event browser
-    bool storage_{false};                           ///< Will the next event generated be stored?
+    std::unique_ptr<proc::Process> process_;                       ///< Local instance of the physics process
+    const RunParameters* run_parameters_{nullptr};                 ///< Generator-owned runtime parameters
+    const std::unique_ptr<utils::Timer> timer_;                    ///< Timekeeper for event generation
+    utils::EventBrowser bws_;                                      ///< Event browser
+    std::vector<utils::EventBrowser::Accessor> taming_variables_;  ///< Precompiled taming functions variables
+    Particles single_particle_{1};                                 ///< Buffer for single-particle cuts evaluation
+    Event unmodified_event_;                                       ///< Event content before its deferred modification
+    bool storage_{false};                                          ///< Will the next event generated be stored?
+    bool deferred_modification_{false};                            ///< Are event modification algorithms deferred?
+    bool local_modules_{false};                                    ///< Are modifiers/taming functions private copies?
+    bool local_event_modifiers_built_{false};                      ///< Are the private modifiers already built?
+    bool local_taming_functions_built_{false};                     ///< Are the private taming functions already built?
+    std::unique_ptr<Value> cross_section_;                         ///< Cross-section to feed to the private modifiers
+    /// Private copies of the event modification algorithms (if local modules are used)
+    std::vector<std::unique_ptr<EventModifier> > event_modifiers_;
+    /// Private copies of the taming functions (if local modules are used)
+    std::vector<std::unique_ptr<utils::Functional> > taming_functions_;
   };
 }  // namespace cepgen
 
@@ -0,0 +1,43 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_Integration_VegasGrid_h
+#define CepGen_Integration_VegasGrid_h
+
+#include <cstddef>
+#include <vector>
+
+namespace cepgen::vegas {
+  /// Map a batch of points from the unit hypercube through a Vegas importance sampling grid
+  /// \note The per-dimension loop is branch-free and works on contiguous, flattened buffers, so that it can be
+  ///  vectorised by the compiler
+  /// \param[in] grid Grid bin edges, as a (num_bins + 1) x ndim bin-major table (as in GSL's Vegas state)
+  /// \param[in] num_bins Number of grid bins per dimension
+  /// \param[in] ndim Phase space dimension
+  /// \param[in] points Flattened collection of coordinates sets in the unit hypercube, with ndim coordinates per point
+  /// \param[out] treated_points Flattened collection of coordinates sets, distributed according to the grid
+  /// \param[out] jacobians Jacobian of the transformation for each point
+  void treat(const double* grid,
+             size_t num_bins,
+             size_t ndim,
+             const std::vector<double>& points,
+             std::vector<double>& treated_points,
+             std::vector<double>& jacobians);
+}  // namespace cepgen::vegas
+
+#endif
@@ -27,7 +27,9 @@ namespace cepgen {
   public:
     explicit Coupling(const ParametersList& params) : NamedModule(params) {}
     ~Coupling() override {}
-    virtual double operator()(double q) const = 0;  ///< Compute \f$\alpha_{S,EM}\f$ for a given \f$Q\f$
+    /// Compute \f$\alpha_{S,EM}\f$ for a given \f$Q\f$
+    /// \note This evaluation is expected to be reentrant, as a single instance may be shared between several threads
+    virtual double operator()(double q) const = 0;
   };
 }  // namespace cepgen
 
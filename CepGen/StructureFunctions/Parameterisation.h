@@ -20,6 +20,7 @@
 #define CepGen_StructureFunctions_Parameterisation_h
 
 #include <memory>
+#include <mutex>
 
 #include "CepGen/StructureFunctions/SigmaRatio.h"
 
@@ -74,8 +75,23 @@ namespace cepgen::strfun {
       double fm{0.};  ///< Magnetic proton form factor
     };
 
+    /// Thread-safe computation of all structure functions for a given \f$(x_{\rm Bj},Q^2)\f$ couple
+    /// \note Unlike the call operator, this evaluation may be called concurrently from several threads on a single
+    ///  instance
+    Values evaluate(const Arguments&) const;
+
   protected:
-    virtual void eval() = 0;  ///< Local structure functions evaluation method
+    /// Local (stateful) structure functions evaluation method
+    /// \note The default implementation forwards the computation to the stateless compute() method
+    virtual void eval();
+    /// Stateless computation of the structure functions (at least \f$F_2\f$ and \f$F_L\f$) for a given point
+    /// \note The default implementation serialises the calls to the stateful eval() method. Reentrant
+    ///  parameterisations are expected to override it (and only it).
+    virtual Values compute(const Arguments&) const;
+    /// Longitudinal structure function from \f$F_2\f$ and the longitudinal/transverse cross section ratio
+    double flFromF2(const Arguments&, double f2) const;
+    /// Stateless computation of the structure functions of another parameterisation (e.g. for hybrid modellings)
+    static inline Values computeFrom(const Parameterisation& sf, const Arguments& args) { return sf.compute(args); }
 
     /// Compute the longitudinal structure function for a given point
     virtual Parameterisation& computeFL(double xbj, double q2);
@@ -112,6 +128,8 @@ namespace cepgen::strfun {
   private:
     Values vals_;
     bool fl_computed_{false};
+    mutable std::mutex eval_mutex_;  ///< Serialisation of the stateful evaluations
+    bool in_eval_{false};            ///< Is a serialised stateful evaluation ongoing?
   };
 }  // namespace cepgen::strfun
 
@@ -0,0 +1,59 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_Utils_AliasTable_h
+#define CepGen_Utils_AliasTable_h
+
+#include <cstddef>
+#include <vector>
+
+namespace cepgen::utils {
+  class RandomGenerator;
+  /// Walker/Vose alias table for constant-time sampling of a discrete distribution
+  /// \note Increases of individual weights are handled incrementally, through a small residual table
+  ///  sampled in logarithmic time; the alias table is rebuilt once this residual becomes too large
+  class AliasTable {
+  public:
+    AliasTable() = default;
+    explicit AliasTable(const std::vector<double>& weights);  ///< Build the table from a collection of weights
+
+    void build(const std::vector<double>& weights);  ///< (Re)build the table from a collection of weights
+    void update(size_t index, double weight);        ///< Modify the weight of one single entry
+
+    inline size_t size() const { return weights_.size(); }                   ///< Number of entries
+    inline double total() const { return table_total_ + residual_total_; }   ///< Sum of all weights
+    inline double weight(size_t index) const { return weights_.at(index); }  ///< Weight of one entry
+    /// Probability for one entry to be sampled
+    double probability(size_t index) const;
+
+    size_t sample(RandomGenerator&) const;  ///< Sample one entry according to its weight
+
+  private:
+    void rebuild();
+
+    std::vector<double> weights_;              ///< Current weights of all entries
+    std::vector<double> probability_;          ///< Acceptance probability of each table entry
+    std::vector<size_t> alias_;                ///< Alias of each table entry
+    double table_total_{0.};                   ///< Sum of all weights encoded in the alias table
+    std::vector<size_t> residual_indices_;     ///< Entries with a weight increased since the last rebuild
+    std::vector<double> residual_cumulative_;  ///< Cumulative weight increases since the last rebuild
+    double residual_total_{0.};                ///< Sum of all weight increases since the last rebuild
+  };
+}  // namespace cepgen::utils
+
+#endif
@@ -0,0 +1,138 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_Utils_BinaryEventFile_h
+#define CepGen_Utils_BinaryEventFile_h
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include "CepGen/Event/Event.h"
+#include "CepGen/Utils/Value.h"
+
+namespace cepgen::utils {
+  class MappedFile;
+  /// Reader for the CepGen-native binary events format
+  /// \note The file is mapped in memory, and events are accessed in any order as views on its particles columns
+  class BinaryEventReader {
+    /// Location of the particles columns of a block of events in the mapped file
+    struct Chunk {
+      size_t first_event{0}, num_events{0};         ///< Index of the first event, and number of events in the chunk
+      const double *px, *py, *pz, *energy;          ///< Particles four-momenta
+      const int32_t *pdg_id, *role, *status;        ///< Particles (signed) PDG identifiers, roles, and statuses
+      const uint32_t* event_particles;              ///< Offset of the first particle of each event
+      const uint32_t* particle_mothers;             ///< Offset of the first mother of each particle
+      const uint32_t* mothers;                      ///< Mothers indices in the event
+      const uint32_t* event_metadata;               ///< Offset of the first metadata field of each event
+      const uint32_t* metadata_keys;                ///< Metadata fields keys (as indices in the chunk keys list)
+      const float* metadata_values;                 ///< Metadata fields values
+      std::vector<Event::EventMetadata::Key> keys;  ///< Interned metadata keys used in the chunk
+    };
+
+  public:
+    explicit BinaryEventReader(const std::string& path);
+
+    static bool isBinaryEventFile(const std::string& path);  ///< Is the file in the binary events format?
+
+    /// Read-only view on an event stored in the file
+    class EventView {
+    public:
+      inline size_t size() const { return num_particles_; }  ///< Number of particles in the event
+      /// Signed PDG identifier of a particle
+      inline int pdgId(size_t i) const { return chunk_->pdg_id[first_particle_ + i]; }
+      /// Role of a particle in the process
+      inline Particle::Role role(size_t i) const {
+        return static_cast<Particle::Role>(chunk_->role[first_particle_ + i]);
+      }
+      /// Decay/stability status of a particle
+      inline int status(size_t i) const { return chunk_->status[first_particle_ + i]; }
+      /// Four-momentum of a particle
+      inline Momentum momentum(size_t i) const {
+        const auto j = first_particle_ + i;
+        return Momentum::fromPxPyPzE(chunk_->px[j], chunk_->py[j], chunk_->pz[j], chunk_->energy[j]);
+      }
+      /// Range of indices (in the event) of the mothers of a particle
+      inline std::pair<const uint32_t*, const uint32_t*> mothers(size_t i) const {
+        const auto j = first_particle_ + i;
+        return {chunk_->mothers + chunk_->particle_mothers[j], chunk_->mothers + chunk_->particle_mothers[j + 1]};
+      }
+      float metadata(Event::EventMetadata::Key) const;  ///< Metadata value associated with a key (or -1)
+      void fill(Event&) const;                          ///< Populate an event, reusing its storage
+
+    private:
+      friend class BinaryEventReader;
+      EventView(const Chunk&, size_t);
+
+      const Chunk* chunk_;     ///< Chunk holding the event columns
+      size_t event_;           ///< Event index in the chunk
+      size_t first_particle_;  ///< Index of the first particle of the event in the chunk
+      size_t num_particles_;   ///< Number of particles in the event
+    };
+
+    EventView operator[](size_t) const;                         ///< View on an event, from its index in the file
+    inline size_t size() const { return num_events_; }          ///< Number of events stored in the file
+    inline size_t numChunks() const { return chunks_.size(); }  ///< Number of events chunks in the file
+    /// Process cross-section and uncertainty, in pb
+    inline const Value& crossSection() const { return cross_section_; }
+
+  private:
+    const std::shared_ptr<const MappedFile> mapping_;  ///< Memory mapping of the file content
+    std::vector<Chunk> chunks_;                        ///< Location of all events chunks in the file
+    size_t num_events_{0};                             ///< Number of events stored in the file
+    Value cross_section_;                              ///< Process cross-section and uncertainty, in pb
+  };
+
+  /// Writer for the CepGen-native binary events format
+  /// \note Events are buffered as particles columns, and written by chunks of fixed size
+  class BinaryEventWriter {
+  public:
+    explicit BinaryEventWriter(const std::string& path, size_t chunk_size = 1000);
+    ~BinaryEventWriter();  ///< Write the last chunk and the index of the file
+
+    void write(const Event&);  ///< Append an event to the file
+    /// Specify the process cross-section and uncertainty, in pb
+    inline void setCrossSection(const Value& cross_section) { cross_section_ = cross_section; }
+
+  private:
+    void flush();  ///< Write the buffered events chunk (stream state to be checked by the caller)
+    void clear();  ///< Empty the events chunk buffer, keeping its storage allocated
+
+    const std::string path_;                       ///< Output file path
+    std::ofstream file_;                           ///< Output file stream
+    const size_t chunk_size_;                      ///< Maximum number of events per chunk
+    Value cross_section_;                          ///< Process cross-section and uncertainty, in pb
+    uint64_t num_events_{0};                       ///< Number of events written
+    std::vector<uint64_t> chunk_offsets_;          ///< Position of each chunk in the file
+    std::vector<uint64_t> chunk_first_events_;     ///< Index of the first event of each chunk
+    std::vector<double> px_, py_, pz_, energy_;    ///< Buffered particles four-momenta
+    std::vector<int32_t> pdg_id_, role_, status_;  ///< Buffered particles PDG identifiers, roles, and statuses
+    std::vector<uint32_t> event_particles_;        ///< Buffered offset of the first particle of each event
+    std::vector<uint32_t> particle_mothers_;       ///< Buffered offset of the first mother of each particle
+    std::vector<uint32_t> mothers_;                ///< Buffered mothers indices
+    std::vector<uint32_t> event_metadata_;         ///< Buffered offset of the first metadata field of each event
+    std::vector<uint32_t> metadata_keys_;          ///< Buffered metadata fields keys
+    std::vector<float> metadata_values_;           ///< Buffered metadata fields values
+    std::vector<std::string> keys_;                ///< Names of the metadata keys used in the chunk
+    std::vector<int> chunk_keys_;                  ///< Index in the chunk keys list of each interned key
+    std::vector<int> particle_index_;              ///< Index in the event of each particle identifier
+  };
+}  // namespace cepgen::utils
+
+#endif
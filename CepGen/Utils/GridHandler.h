@@ -30,30 +30,61 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <string>
 
 #include "CepGen/Utils/Limits.h"
 
 namespace cepgen {
+  namespace utils {
+    class MappedFile;
+  }
   /// Interpolation type for the grid coordinates
   enum struct GridType { linear, logarithmic, square };
+  /// Interpolation kernel for the dense (multi-dimensional) grids
+  enum struct GridKernel { linear, cubic };
   /// A generic class for \f$\mathbb{R}^D\mapsto\mathbb{R}^N\f$ grid interpolation
+  /// \note One-dimensional grids (and two-dimensional, linearly interpolated grids if GSL≥2.1 is available) are
+  ///  interpolated using GSL splines. All other grids are stored as a dense, row-major array of node values, and
+  ///  interpolated as a tensor product of linear (or Catmull-Rom cubic, shared with the UniformGrid tables) kernels.
+  ///  Nodes lookup is a direct index computation for equally-spaced coordinates, and a binary search otherwise.
   /// \tparam D Number of variables in the grid (dimension)
   /// \tparam N Number of values handled per point
   template <size_t D, size_t N = 1>
   class GridHandler {
   public:
-    explicit GridHandler(const GridType& grid_type);  ///< Build a grid interpolator from a grid type
+    /// Build a grid interpolator from a grid type
+    explicit GridHandler(const GridType& grid_type, const GridKernel& kernel = GridKernel::linear);
     virtual ~GridHandler() = default;
 
     using coord_t = std::vector<double>;     ///< Coordinates container
     using values_t = std::array<double, N>;  ///< Value(s) at a given coordinate
+    /// Interpolation accelerators (last grid cells looked up along each coordinate), to be value-initialised
+    using accel_t = std::array<gsl_interp_accel, D>;
 
     values_t eval(const coord_t& in_coords) const;  ///< Interpolate a point to a given coordinate
+    /// Interpolate a point to a given coordinate, using caller-owned accelerators
+    /// \note The grid itself is left untouched by the evaluation, allowing concurrent calls from several threads
+    ///  (each owning its accelerators) on a single instance
+    values_t eval(const coord_t& in_coords, accel_t& accelerators) const;
+    /// Interpolate a collection of points to their coordinates
+    void evalBatch(const std::vector<coord_t>& in_coords, std::vector<values_t>& out_values) const;
 
     void insert(const coord_t& coord, values_t value);                         ///< Insert a new value in the grid
     inline std::map<coord_t, values_t> values() const { return values_raw_; }  ///< List of values in the grid
 
     void initialise();                         ///< Initialise the grid and all useful interpolators/accelerators
+
+    /// Fill the grid from a pre-indexed binary grid file, mapped read-only in memory
+    /// \note Multi-dimensional grids values are interpolated directly from the mapped file content (without any copy),
+    ///  and are therefore not listed in the values() collection
+    /// \return Auxiliary information stored alongside the grid nodes
+    std::string load(const std::string& path);
+    /// Store the (initialised) grid into a pre-indexed binary grid file
+    /// \param[in] path Output file path
+    /// \param[in] metadata Auxiliary information (e.g. grid provenance) to be stored alongside the grid nodes
+    void save(const std::string& path, const std::string& metadata = "") const;
+    static bool isBinaryGrid(const std::string& path);  ///< Is a file a pre-indexed binary grid?
+
     std::array<Limits, D> boundaries() const;  ///< Grid boundaries (collection of (min,max))
     std::array<double, D> min() const;         ///< Lowest bound of the grid coordinates
     std::array<double, D> max() const;         ///< Highest bound of the grid coordinates
@@ -61,8 +92,6 @@ namespace cepgen {
   protected:
     const GridType grid_type_;                ///< Type of interpolation for the grid members
     std::map<coord_t, values_t> values_raw_;  ///< List of coordinates and associated value(s) in the grid
-    /// Grid interpolation accelerator
-    std::vector<std::unique_ptr<gsl_interp_accel, void (*)(gsl_interp_accel*)> > accelerators_;
     std::vector<std::unique_ptr<gsl_spline, void (*)(gsl_spline*)> > splines_1d_;  ///< Splines for linear interpolations
 #ifdef GSL_VERSION_ABOVE_2_1
     /// Splines for bilinear interpolations
@@ -72,14 +101,20 @@ namespace cepgen {
     std::array<std::unique_ptr<double[]>, N> values_;  ///< Values for all points in the grid
 
   private:
-    void findIndices(const coord_t& coord, coord_t& min, coord_t& max) const;  ///< Lower/upper indices for a coordinate
-    /// A single value in grid coordinates
-    struct grid_point_t : values_t {
-      grid_point_t(const values_t& arr) : values_t(arr) {}
-      grid_point_t operator*(double c) const;
-      grid_point_t operator+(const grid_point_t& rhs) const;
-    };
-    bool initialised_{false};  ///< Has the extrapolator been initialised?
+    void initialiseIndexing();                               ///< Compute the dense nodes indexing parameters
+    void initialiseDense();                                  ///< Fill the dense nodes values array
+    std::vector<double> denseValues() const;                 ///< Nodes values in the dense, row-major ordering
+    values_t evalDense(const std::array<double, D>&) const;  ///< Dense grid interpolation at a (transformed) coordinate
+
+    const GridKernel kernel_;            ///< Interpolation kernel for dense grids
+    bool dense_{false};                  ///< Is the grid interpolated from its dense nodes values array?
+    std::vector<double> nodes_values_;   ///< Dense nodes values (N per node), owned by the grid
+    const double* nodes_{nullptr};       ///< Dense nodes values, in row-major (last coordinate fastest) order
+    std::array<size_t, D> strides_{};    ///< Offset between two consecutive nodes along each dimension
+    std::array<double, D> inv_steps_{};  ///< Inverse coordinate step along each dimension (0 if not equally spaced)
+    bool initialised_{false};            ///< Has the extrapolator been initialised?
+    /// Memory-mapped binary grid file, if any (holds the dense nodes values for loaded grids)
+    std::shared_ptr<const utils::MappedFile> mapping_;
   };
 }  // namespace cepgen
 
@@ -22,6 +22,7 @@
 #include <gsl/gsl_histogram.h>
 #include <gsl/gsl_histogram2d.h>
 
+#include <algorithm>
 #include <array>
 #include <functional>
 #include <memory>
@@ -58,6 +59,27 @@ namespace cepgen::utils {
     static std::set<double> extractBins(BinMode mode,
                                         size_t num_bins,
                                         const std::function<Limits(size_t)>& bins_extractor);
+    /// Arithmetic computation of the bin index for a value, on a uniform-width binning
+    /// \param[in] range bins limits (num_bins+1 values)
+    /// \param[in] num_bins total number of bins
+    /// \param[in] inv_bin_width inverse of the bins width
+    /// \param[in] x value to locate
+    /// \param[out] bin bin index
+    /// \return false if the value is out of range
+    static inline bool findUniformBin(const double* range,
+                                      size_t num_bins,
+                                      double inv_bin_width,
+                                      double x,
+                                      size_t& bin) {
+      if (!(x >= range[0] && x < range[num_bins]))  // also rejects NaN values
+        return false;
+      bin = std::min(static_cast<size_t>((x - range[0]) * inv_bin_width), num_bins - 1);
+      if (x < range[bin])  // rounding errors at the bins limits
+        --bin;
+      else if (x >= range[bin + 1])
+        ++bin;
+      return true;
+    }
   };
 
   /// 1D histogram container
@@ -76,6 +98,8 @@ namespace cepgen::utils {
     void clear() override;
     void fill(double x, double weight = 1.);  ///< Increment the histogram with one value
     void add(Hist1D, double scaling = 1.);    ///< Bin-to-bin addition of another histogram to this one
+    /// Exact bin-to-bin sum of another histogram with identical binning (e.g. filled by another thread)
+    void merge(const Hist1D&);
     void scale(double) override;
     double sample(RandomGenerator&) const;  ///< Sample individual "events" from a distribution
 
@@ -108,6 +132,7 @@ namespace cepgen::utils {
   private:
     void buildFromBins(const std::vector<double>&);
     void buildFromRange(size_t, const Limits&);
+    bool findBin(double x, size_t& bin) const;  ///< Retrieve the bin index for an x value, if in range
 
     struct gsl_histogram_deleter {
       void operator()(gsl_histogram* h) const { gsl_histogram_free(h); }
@@ -115,6 +140,7 @@ namespace cepgen::utils {
     using gsl_histogram_ptr = std::unique_ptr<gsl_histogram, gsl_histogram_deleter>;
     gsl_histogram_ptr hist_, hist_w2_;
     size_t underflow_{0ull}, overflow_{0ull};
+    double inv_bin_width_{0.};  ///< Inverse of the bins width for a uniform binning (0 otherwise)
     struct gsl_histogram_pdf_deleter {
       void operator()(gsl_histogram_pdf* h) const { gsl_histogram_pdf_free(h); }
     };
@@ -148,6 +174,8 @@ namespace cepgen::utils {
     /// Fill the histogram with one value
     inline void fill(const std::pair<double, double>& xy, double weight = 1.) { fill(xy.first, xy.second, weight); }
     void add(Hist2D, double scaling = 1.);  ///< Bin-by-bin addition of another histogram to this one
+    /// Exact bin-by-bin sum of another histogram with identical binning (e.g. filled by another thread)
+    void merge(const Hist2D&);
     void scale(double) override;
     std::pair<double, double> sample(RandomGenerator&) const;  ///< Sample individual "events" from a distribution
 
@@ -197,6 +225,7 @@ namespace cepgen::utils {
   private:
     void buildFromBins(const std::vector<double>&, const std::vector<double>&);
     void buildFromRange(size_t, const Limits&, size_t, const Limits&);
+    bool findBin(double x, double y, size_t& bin_x, size_t& bin_y) const;  ///< Retrieve the bin indices, if in range
 
     struct gsl_histogram2d_deleter {
       void operator()(gsl_histogram2d* h) const { gsl_histogram2d_free(h); }
@@ -204,6 +233,7 @@ namespace cepgen::utils {
     using gsl_histogram2d_ptr = std::unique_ptr<gsl_histogram2d, gsl_histogram2d_deleter>;
     gsl_histogram2d_ptr hist_, hist_w2_;
     contents_t out_of_range_values_;
+    double inv_bin_width_x_{0.}, inv_bin_width_y_{0.};  ///< Inverse of the bins widths for a uniform binning (or 0)
     struct gsl_histogram2d_pdf_deleter {
       void operator()(gsl_histogram2d_pdf* h) const { gsl_histogram2d_pdf_free(h); }
     };
@@ -19,6 +19,7 @@
 #ifndef CepGen_Utils_Logger_h
 #define CepGen_Utils_Logger_h
 
+#include <atomic>
 #include <regex>
 #include <vector>
 
@@ -44,8 +45,29 @@ namespace cepgen::utils {
     /// \param[in] tmpl Module name to probe
     /// \param[in] lev Upper verbosity level
     bool passExceptionRule(const std::string& tmpl, const Level& lev) const;
-    inline Level level() const { return level_; }                  ///< Logging threshold
-    inline void setLevel(Level level) { level_ = level; }          ///< Set the logging threshold
+
+    /// Logging decision cached at a given call site, valid until the logging threshold or rules are modified
+    struct CallSite {
+      std::atomic<unsigned long long> state{0};  ///< Configuration generation (all bits but first) and decision
+    };
+    /// Is the module set to be displayed/logged? (for a constant module name, decision cached at the call site)
+    template <size_t N>
+    inline bool passExceptionRule(const char (&tmpl)[N], const Level& lev, CallSite& site) const {
+      if (const auto state = site.state.load(std::memory_order_relaxed);
+          (state >> 1) == generation_.load(std::memory_order_relaxed))
+        return state & 1;
+      return updateCallSite(tmpl, lev, site, true);
+    }
+    /// Is the module set to be displayed/logged? (decision only cached at the call site if independent of the module)
+    inline bool passExceptionRule(const std::string& tmpl, const Level& lev, CallSite& site) const {
+      if (const auto state = site.state.load(std::memory_order_relaxed);
+          (state >> 1) == generation_.load(std::memory_order_relaxed))
+        return state & 1;
+      return updateCallSite(tmpl, lev, site, false);
+    }
+
+    inline Level level() const { return level_; }  ///< Logging threshold
+    void setLevel(Level level);                    ///< Set the logging threshold
     inline bool extended() const { return extended_; }             ///< Also show extended information?
     inline void setExtended(bool ext = true) { extended_ = ext; }  ///< Set the extended information flag
     bool isTTY() const;                                            ///< Is the stream handled a TTY-like stream?
@@ -55,18 +77,27 @@ namespace cepgen::utils {
 
   private:
     explicit Logger(StreamHandler);  ///< Initialise a logging object
+    /// Evaluate the logging decision, and store it in a call site cache if possible
+    bool updateCallSite(const std::string& tmpl, const Level& lev, CallSite& site, bool constant_module) const;
 
-    std::vector<std::regex> allowed_exc_;  ///< List of enabled logging modules
-    bool extended_{false};                 ///< Also print extra attributes?
-    Level level_{Level::information};      ///< Logging threshold for the output stream
-    StreamHandler output_{nullptr};        ///< Output stream to use for all logging operations
+    std::atomic<unsigned long long> generation_{1};  ///< Logging configuration generation (for call site caches)
+    std::vector<std::regex> allowed_exc_;            ///< List of enabled logging modules
+    bool extended_{false};                           ///< Also print extra attributes?
+    Level level_{Level::information};                ///< Logging threshold for the output stream
+    StreamHandler output_{nullptr};                  ///< Output stream to use for all logging operations
   };
 }  // namespace cepgen::utils
 namespace cepgen {
   std::ostream& operator<<(std::ostream& os, const utils::Logger::Level&);
 }
 
-#define CG_LOG_MATCH(str, type) cepgen::utils::Logger::get().passExceptionRule(str, cepgen::utils::Logger::Level::type)
+/// Logging decision for a module and a verbosity level, with a cache (static) object for each call site
+#define CG_LOG_MATCH(str, type)                                                           \
+  cepgen::utils::Logger::get().passExceptionRule(                                         \
+      str, cepgen::utils::Logger::Level::type, []() -> cepgen::utils::Logger::CallSite& { \
+        static cepgen::utils::Logger::CallSite site;                                      \
+        return site;                                                                      \
+      }())
 #define CG_LOG_LEVEL(type) cepgen::utils::Logger::get().setLevel(cepgen::utils::Logger::Level::type)
 
 #endif
@@ -0,0 +1,45 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_Utils_MappedFile_h
+#define CepGen_Utils_MappedFile_h
+
+#include <string>
+
+namespace cepgen::utils {
+  /// Read-only memory mapping of a file
+  /// \note The mapped pages are shared between all processes accessing the file through the page cache
+  class MappedFile {
+  public:
+    explicit MappedFile(const std::string& path);  ///< Map the whole content of a file
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    inline const std::string& path() const { return path_; }  ///< Path to the mapped file
+    inline const char* data() const { return data_; }         ///< Beginning of the mapped region
+    inline size_t size() const { return size_; }              ///< Size of the mapped region, in bytes
+
+  private:
+    const std::string path_;     ///< Path to the mapped file
+    const char* data_{nullptr};  ///< Beginning of the mapped region
+    size_t size_{0};             ///< Size of the mapped region, in bytes
+  };
+}  // namespace cepgen::utils
+
+#endif
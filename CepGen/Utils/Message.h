@@ -205,10 +205,14 @@ namespace cepgen {
   (!CG_LOG_MATCH(mod, debug)) \
       ? cepgen::NullStream()  \
       : cepgen::LoggedMessage(mod, __FUNC__, cepgen::LoggedMessage::MessageType::debug, __FILE__, __LINE__)
+#ifdef CEPGEN_NO_DEBUG_LOOP  // in-loop debugging messages stripped at compile time; streamed operands never evaluated
+#define CG_DEBUG_LOOP(mod) true ? cepgen::NullStream() : cepgen::NullStream()
+#else
 #define CG_DEBUG_LOOP(mod)              \
   (!CG_LOG_MATCH(mod, debugInsideLoop)) \
       ? cepgen::NullStream()            \
       : cepgen::LoggedMessage(mod, __FUNC__, cepgen::LoggedMessage::MessageType::debug, __FILE__, __LINE__)
+#endif
 #define CG_WARNING(mod)         \
   (!CG_LOG_MATCH(mod, warning)) \
       ? cepgen::NullStream()    \
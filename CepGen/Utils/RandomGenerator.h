@@ -19,6 +19,8 @@
 #ifndef CepGen_Utils_RandomGenerator_h
 #define CepGen_Utils_RandomGenerator_h
 
+#include <vector>
+
 #include "CepGen/Modules/NamedModule.h"
 
 namespace cepgen::utils {
@@ -36,6 +38,14 @@ namespace cepgen::utils {
     virtual int uniformInt(int min, int max) = 0;
     virtual double uniform(double min = 0., double max = 1.) = 0;
     virtual double normal(double mean = 0., double rms = 1.) = 0;
+    /// Fill a buffer with uniformly distributed random numbers
+    /// \param[out] values Buffer to fill
+    /// \param[in] num_values Number of random numbers to generate
+    virtual void fillUniform(double* values, size_t num_values, double min = 0., double max = 1.);
+    /// Fill a collection with uniformly distributed random numbers
+    inline void fillUniform(std::vector<double>& values, double min = 0., double max = 1.) {
+      fillUniform(values.data(), values.size(), min, max);
+    }
 
     // specialised distributions
     virtual double exponential(double exponent = 1.);
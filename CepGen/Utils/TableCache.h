@@ -0,0 +1,96 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_Utils_TableCache_h
+#define CepGen_Utils_TableCache_h
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cepgen::utils {
+  /// On-disk persistency of precomputed numerical tables (e.g. interpolation grids nodes values)
+  /// \note Cache files are indexed by a hash of the serialised configuration the table was computed for, and the full
+  ///  configuration is stored alongside the values to protect against hash collisions.
+  class TableCache {
+  public:
+    /// Build a cache handler for a table
+    /// \param[in] path Directory where the cached tables are stored
+    /// \param[in] name Table type, used as a cache file name prefix
+    /// \param[in] configuration Serialised configuration (e.g. module parameters and grid definition) of the table
+    explicit TableCache(const std::string& path, const std::string& name, const std::string& configuration);
+
+    /// Retrieve the table cached for this configuration, if any
+    /// \return A boolean stating whether a valid table was found
+    bool load(std::vector<double>& values) const;
+    void store(const std::vector<double>& values) const;  ///< Store a table into the cache
+
+    inline const std::string& filename() const { return filename_; }  ///< Path to the cache file
+
+    /// Retrieve the in-memory table shared by all modules built with the same configuration, or build it
+    /// \note Tables are immutable once built, and kept for the whole process lifetime. Concurrent requests for a table
+    ///  being built wait for its completion, while the builder itself runs without holding any lock.
+    /// \param[in] name Table type
+    /// \param[in] configuration Serialised configuration of the table
+    /// \param[in] builder Table computation algorithm, only called if no table was built for this configuration
+    template <typename T>
+    static std::shared_ptr<const T> shared(const std::string& name,
+                                           const std::string& configuration,
+                                           const std::function<std::unique_ptr<T>()>& builder) {
+      using table_t = std::shared_future<std::shared_ptr<const T> >;
+      static std::mutex tables_mutex;
+      static std::unordered_map<std::string, table_t> tables;
+      const auto key = name + ":" + configuration;
+      std::promise<std::shared_ptr<const T> > promise;
+      table_t table;
+      bool build = false;
+      {
+        const std::lock_guard<std::mutex> lock(tables_mutex);
+        if (auto it = tables.find(key); it != tables.end())
+          table = it->second;
+        else {
+          table = tables[key] = promise.get_future().share();
+          build = true;
+        }
+      }
+      if (build) {
+        try {
+          promise.set_value(builder());
+        } catch (...) {
+          {  // allow a subsequent attempt to build the table
+            const std::lock_guard<std::mutex> lock(tables_mutex);
+            tables.erase(key);
+          }
+          promise.set_exception(std::current_exception());
+        }
+      }
+      return table.get();
+    }
+
+  private:
+    const std::string path_;           ///< Cache directory
+    const std::string configuration_;  ///< Serialised table configuration
+    const std::string filename_;       ///< Path to the cache file for this table configuration
+  };
+}  // namespace cepgen::utils
+
+#endif
@@ -1,6 +1,6 @@
 /*
  *  CepGen: a central exclusive processes event generator
- *  Copyright (C) 2020-2024  Laurent Forthomme
+ *  Copyright (C) 2020-2025  Laurent Forthomme
  *
  *  This program is free software: you can redistribute it and/or modify
  *  it under the terms of the GNU General Public License as published by
@@ -19,7 +19,11 @@
 #ifndef CepGen_Utils_TimeKeeper_h
 #define CepGen_Utils_TimeKeeper_h
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -31,13 +35,17 @@
 
 namespace cepgen::utils {
   /// Collection of clocks to benchmark execution blocks
+  /// \note Timing samples are not stored but accumulated into bounded-size running statistics, locally to each
+  ///  calling thread, and merged upon request
   class TimeKeeper {
   public:
-    explicit TimeKeeper() = default;
+    /// Build a timekeeper
+    /// \param[in] with_histograms also fill a fixed-size latency histogram for each monitor (for quantiles estimation)
+    explicit TimeKeeper(bool with_histograms = false);
 
-    void clear();                                            ///< Reset all counters and the timer
-    inline bool empty() const { return monitors_.empty(); }  ///< Check if at least one monitor recorded something
-    std::string summary() const;                             ///< Write a summary of all monitors
+    void clear();                 ///< Reset all counters and the timer
+    bool empty() const;           ///< Check if at least one monitor recorded something
+    std::string summary() const;  ///< Write a summary of all monitors
 
     /// Count the time for one monitor
     /// \param[in] func monitor to increment
@@ -46,6 +54,41 @@ namespace cepgen::utils {
 
     const Timer& timer() const;  ///< Local timer object
 
+    /// Running statistics for the timing samples of a single monitor
+    class Monitor {
+    public:
+      explicit Monitor(bool with_histogram = false);
+
+      void fill(double time);                       ///< Add a new timing sample, in seconds
+      Monitor& operator+=(const Monitor&);          ///< Merge the statistics of another monitor
+      inline size_t size() const { return num_; }   ///< Number of timing samples collected
+      inline double total() const { return sum_; }  ///< Total time, in seconds
+      double mean() const;                          ///< Average time, in seconds
+      double rms() const;                           ///< Root-mean-square of the timing samples, in seconds
+      inline double min() const { return min_; }    ///< Minimum time, in seconds
+      inline double max() const { return max_; }    ///< Maximum time, in seconds
+      /// Is the latency histogram filled?
+      inline bool hasHistogram() const { return !histogram_.empty(); }
+      /// Estimate a quantile of the timing distribution from the latency histogram
+      /// \param[in] q quantile, in [0, 1]
+      /// \return time below which a fraction q of the samples lies, in seconds (-1 if no histogram is filled)
+      double quantile(double q) const;
+
+    private:
+      /// Number of logarithmic bins per power of two, setting the relative resolution of the latency histogram
+      static constexpr size_t kNumSubBins = 16;
+      static constexpr size_t kNumPowers = 42;  ///< Powers of two covered by the histogram (from 1 ns to ~70 min)
+      static size_t bin(double time);           ///< Histogram bin index for a timing sample, in seconds
+      static double binCentre(size_t bin);      ///< Central time value of a histogram bin, in seconds
+
+      size_t num_{0};
+      double sum_{0.}, sum2_{0.}, min_{0.}, max_{0.};
+      std::vector<unsigned long long> histogram_;
+    };
+    std::map<std::string, Monitor> monitors() const;  ///< Statistics for all monitors, merged over all threads
+    /// Merge the statistics collected by another timekeeper
+    TimeKeeper& merge(const TimeKeeper&);
+
     /// Scoped timekeeping utility
     class Ticker {
     public:
@@ -59,8 +102,18 @@ namespace cepgen::utils {
     };
 
   private:
-    std::unordered_map<std::string, std::vector<float> > monitors_;
+    /// Collection of monitors filled by a single thread
+    struct ThreadMonitors {
+      std::mutex mutex;  ///< Only contended when the statistics are collected
+      std::unordered_map<std::string, Monitor> monitors;
+    };
+    ThreadMonitors& localMonitors();  ///< Monitors collection for the calling thread
+
+    const unsigned long long id_;  ///< Unique identifier for this timekeeper instance
+    const bool with_histograms_;
+    std::unordered_map<std::thread::id, std::unique_ptr<ThreadMonitors> > thread_monitors_;
     Timer tmr_;
+    mutable std::mutex mutex_;  ///< Protects the per-thread monitors registry
   };
 }  // namespace cepgen::utils
 
@@ -0,0 +1,138 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_Utils_UniformGrid_h
+#define CepGen_Utils_UniformGrid_h
+
+#include <array>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "CepGen/Utils/GridHandler.h"
+
+namespace cepgen {
+  class ParametersDescription;
+  class ParametersList;
+
+  /// Catmull-Rom cubic interpolation stencil along one dimension of equally-spaced nodes
+  /// \note In the first and last cells, the missing stencil node is linearly extrapolated from the two closest ones,
+  ///  and its weight folded into theirs
+  /// \param[in] pos Coordinate, in units of nodes spacing from the first node (clamped to the grid boundaries)
+  /// \param[in] num_nodes Number of nodes along this dimension (at least two)
+  /// \param[out] nodes Indices of the four stencil nodes
+  /// \param[out] weights Interpolation weights of the four stencil nodes
+  void catmullRomStencil(double pos, size_t num_nodes, std::array<size_t, 4>& nodes, std::array<double, 4>& weights);
+  /// Catmull-Rom cubic interpolation stencil along one dimension of arbitrarily-spaced nodes
+  /// \note Node derivatives are estimated from their neighbours' finite differences, which reduces to the
+  ///  equally-spaced stencil for a regular axis, and keeps the interpolation of linear functions exact
+  /// \param[in] axis Sorted nodes coordinates (at least two)
+  /// \param[in] x Coordinate (clamped to the grid boundaries)
+  /// \param[out] nodes Indices of the four stencil nodes
+  /// \param[out] weights Interpolation weights of the four stencil nodes
+  void catmullRomStencil(const std::vector<double>& axis,
+                         double x,
+                         std::array<size_t, 4>& nodes,
+                         std::array<double, 4>& weights);
+
+  /// A dense \f$\mathbb{R}^D\mapsto\mathbb{R}^N\f$ table with regularly-spaced nodes, for fast interpolation
+  /// \note Nodes are equally spaced in the transformed coordinates (e.g. \f$\log_{10}x\f$ for a logarithmic grid),
+  ///  and values are stored in a row-major (last coordinate fastest) array. The cell lookup is a direct index
+  ///  computation, and the interpolation a tensor product of Catmull-Rom cubic kernels on a 4^D nodes stencil.
+  ///  Coordinates outside the grid boundaries are clamped to them.
+  /// \tparam D Number of variables in the grid (dimension)
+  /// \tparam N Number of values handled per node
+  template <size_t D, size_t N = 1>
+  class UniformGrid {
+  public:
+    using coord_t = std::array<double, D>;   ///< Coordinates container
+    using values_t = std::array<double, N>;  ///< Value(s) at a given coordinate
+    using Function = std::function<values_t(const coord_t&)>;  ///< Value(s) computation at a given coordinate
+
+    /// Build a table from its boundaries and nodes multiplicities
+    /// \param[in] ranges Coordinates range along each dimension
+    /// \param[in] num_nodes Number of nodes along each dimension (at least two)
+    /// \param[in] grid_type Spacing of the nodes
+    explicit UniformGrid(const std::array<Limits, D>& ranges,
+                         const std::array<size_t, D>& num_nodes,
+                         const GridType& grid_type = GridType::logarithmic);
+
+    inline size_t size() const { return values_.size(); }                        ///< Number of nodes in the table
+    inline const std::array<Limits, D>& ranges() const { return ranges_; }       ///< Coordinates ranges
+    inline const std::array<size_t, D>& numNodes() const { return num_nodes_; }  ///< Nodes multiplicities
+    /// Is a coordinate within the grid boundaries?
+    bool contains(const coord_t&) const;
+
+    coord_t node(size_t index) const;  ///< Coordinates of a node
+    /// Value(s) at a node
+    inline const values_t& value(size_t index) const { return values_.at(index); }
+    /// Set the value(s) at a node
+    inline void setValue(size_t index, const values_t& value) { values_.at(index) = value; }
+    /// Flattened collection of all node values, N values per node
+    std::vector<double> serialise() const;
+    /// Set all node values from a flattened collection
+    /// \return A boolean stating whether the collection multiplicity matches the table size
+    bool deserialise(const std::vector<double>&);
+    /// Compute all node values over several threads
+    /// \param[in] function_builder Builder of the function evaluated by each thread, called once per thread before
+    ///  the filling starts (e.g. to let each thread rely on its own copies of non-reentrant objects)
+    /// \param[in] num_threads Number of filling threads (0 for all available cores)
+    /// \return Number of threads effectively used
+    size_t fill(const std::function<Function()>& function_builder, size_t num_threads = 0);
+    /// Compare the interpolated value(s) to a reference function at the centre of some grid cells
+    /// \param[in] function Reference function
+    /// \param[in] num_checks Number of cells probed (at most the number of cells in the grid)
+    /// \param[in] norm_indices Value index used to normalise the deviation of each value (if empty, the value itself)
+    /// \return Maximal relative deviation for each value
+    values_t maxRelativeDeviation(const Function& function,
+                                  size_t num_checks,
+                                  const std::vector<size_t>& norm_indices = {}) const;
+    /// Retrieve all node values from the on-disk cache, or compute them and check the interpolation accuracy
+    /// \param[in] name Table type, used as a cache file name prefix and in the log messages
+    /// \param[in] configuration Serialised configuration of the table, used as a cache key
+    /// \param[in] function_builder Builder of the function evaluated by each thread (see fill)
+    /// \param[in] params Filling, caching, and accuracy check parameters (see cachingDescription)
+    /// \param[in] norm_indices Value index used to normalise the deviation of each value (see maxRelativeDeviation)
+    void buildCached(const std::string& name,
+                     const std::string& configuration,
+                     const std::function<Function()>& function_builder,
+                     const ParametersList& params,
+                     const std::vector<size_t>& norm_indices = {});
+    /// Description of the steering parameters for the filling and caching of a table (see buildCached)
+    /// \param[in] num_accuracy_checks Default number of cells probed to estimate the interpolation accuracy
+    /// \param[in] tolerance Default maximal relative interpolation deviation tolerated before warning
+    static ParametersDescription cachingDescription(int num_accuracy_checks, double tolerance);
+
+    values_t eval(const coord_t&) const;  ///< Interpolate the value(s) at a given coordinate
+
+  private:
+    size_t numCells() const;  ///< Number of cells in the table
+    double transform(double) const;
+    double inverseTransform(double) const;
+
+    const GridType grid_type_;               ///< Nodes spacing
+    const std::array<Limits, D> ranges_;     ///< Coordinates ranges
+    const std::array<size_t, D> num_nodes_;  ///< Number of nodes along each dimension
+    std::array<double, D> min_{};            ///< Lowest transformed coordinate along each dimension
+    std::array<double, D> step_{};           ///< Transformed coordinate step along each dimension
+    std::array<size_t, D> strides_{};        ///< Offset between two consecutive nodes along each dimension
+    std::vector<values_t> values_;           ///< Node values, in row-major order
+  };
+}  // namespace cepgen
+
+#endif
@@ -19,6 +19,10 @@
 #ifndef CepGenCuba_CubaIntegrator_h
 #define CepGenCuba_CubaIntegrator_h
 
+#include <sys/types.h>
+
+#include <memory>
+
 #include "CepGen/Integration/Integrator.h"
 
 namespace cepgen {
@@ -28,24 +32,53 @@ namespace cepgen {
 /// Interface objects to Cuba algorithms
 namespace cepgen::cuba {
   /// Cuba integration algorithm
+  /// \note Integrands are evaluated by batches of (at most) nvec points. If Cuba's parallelisation is enabled, each
+  ///  worker process evaluates its own clone of the integrand (if the integrand can be cloned).
   class Integrator : public cepgen::Integrator {
   public:
     explicit Integrator(const ParametersList&);
 
     static ParametersDescription description();
-    static Integrand* gIntegrand;
 
     Value run(Integrand&, const std::vector<Limits>&) override;
 
+    /// Cuba integrand callback, evaluating a batch of points for the integrator object passed as user data
+    /// \param[in] ndim Phase space dimension
+    /// \param[in] xx Flattened list of coordinates, with ndim coordinates per point
+    /// \param[in] ncomp Number of components of the integrand
+    /// \param[out] ff Flattened list of integrand values, with ncomp components per point
+    /// \param[in] userdata Integrator object steering the integration
+    /// \param[in] nvec Number of points in the batch
+    /// \param[in] core Worker process index
+    static int integrand(const int* ndim,
+                         const double xx[],
+                         const int* ncomp,
+                         double ff[],
+                         void* userdata,
+                         const int* nvec,
+                         const int* core);
+
   protected:
     virtual Value integrate() = 0;
 
+    size_t ndim() const;  ///< Integration phase space dimension
+
     int ncomp_, nvec_;
     double epsrel_, epsabs_;
     int mineval_, maxeval_;
-  };
 
-  int cuba_integrand(const int* ndim, const double xx[], const int* /*ncomp*/, double ff[], void* /*userdata*/);
+  private:
+    static void initialiseWorker(void* userdata, const int* core);  ///< Worker process initialisation hook
+    static void finaliseWorker(void* userdata, const int* core);    ///< Worker process finalisation hook
+
+    const int num_cores_;                          ///< Number of Cuba worker processes (-1 for Cuba's default)
+    const int max_core_points_;                    ///< Maximal number of points sent to a worker in one batch
+    Integrand* integrand_{nullptr};                ///< Integrand evaluated by the master process (NOT owned)
+    std::unique_ptr<Integrand> worker_integrand_;  ///< Integrand clone evaluated by a worker process
+    pid_t master_pid_{0};                          ///< Master process identifier
+    std::vector<double> points_;                   ///< Coordinates batch buffer
+    std::vector<double> weights_;                  ///< Integrand values batch buffer
+  };
 }  // namespace cepgen::cuba
 
 #endif
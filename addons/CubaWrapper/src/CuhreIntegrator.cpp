@@ -47,10 +47,10 @@ namespace cepgen::cuba {
       int nregions, neval, fail;
       double integral, error, prob;
 
-      Cuhre(gIntegrand->size(),
+      Cuhre(ndim(),
             ncomp_,
-            cuba_integrand,
-            nullptr,
+            reinterpret_cast<integrand_t>(&Integrator::integrand),
+            this,  // user data
             nvec_,
             epsrel_,
             epsabs_,
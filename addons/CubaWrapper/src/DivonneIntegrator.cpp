@@ -76,10 +76,10 @@ namespace cepgen::cuba {
       std::transform(
           given_.begin(), given_.end(), std::back_inserter(given_arr), [](auto& point) { return point.data(); });
 
-      Divonne(gIntegrand->size(),
+      Divonne(ndim(),
               ncomp_,
-              cuba_integrand,
-              nullptr,
+              reinterpret_cast<integrand_t>(&Integrator::integrand),
+              this,  // user data
               nvec_,
               epsrel_,
               epsabs_,
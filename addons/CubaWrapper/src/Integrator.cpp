@@ -16,13 +16,16 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cuba.h>
+#include <unistd.h>
+
+#include <algorithm>
+
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Integration/Integrand.h"
 #include "CepGenCuba/Integrator.h"
 
 namespace cepgen::cuba {
-  Integrand* Integrator::gIntegrand = nullptr;
-
   Integrator::Integrator(const ParametersList& params)
       : cepgen::Integrator(params),
         ncomp_(steer<int>("ncomp")),
@@ -30,30 +33,91 @@ namespace cepgen::cuba {
         epsrel_(steer<double>("epsrel")),
         epsabs_(steer<double>("epsabs")),
         mineval_(steer<int>("mineval")),
-        maxeval_(steer<int>("maxeval")) {}
+        maxeval_(steer<int>("maxeval")),
+        num_cores_(steer<int>("numCores")),
+        max_core_points_(steer<int>("maxCorePoints")) {
+    if (nvec_ < 1)
+      throw CG_FATAL("cuba:Integrator") << "Invalid number of samples per integrand call: " << nvec_ << ".";
+  }
 
   Value Integrator::run(Integrand& integrand, const std::vector<Limits>& /*range*/) {
-    gIntegrand = &integrand;
-    return integrate();
+    integrand_ = &integrand;
+    worker_integrand_.reset();
+    master_pid_ = ::getpid();
+    if (num_cores_ >= 0)  // otherwise, steered by the CUBACORES environment variable (or the number of idle cores)
+      cubacores(&num_cores_, &max_core_points_);
+    cubainit(reinterpret_cast<void (*)()>(&Integrator::initialiseWorker), this);
+    cubaexit(reinterpret_cast<void (*)()>(&Integrator::finaliseWorker), this);
+    const auto result = integrate();
+    cubainit(nullptr, nullptr);
+    cubaexit(nullptr, nullptr);
+    return result;
+  }
+
+  size_t Integrator::ndim() const {
+    if (!integrand_)
+      throw CG_FATAL("cuba:Integrator") << "Integrand not set for the Cuba algorithm!";
+    return integrand_->size();
   }
 
   ParametersDescription Integrator::description() {
     auto desc = cepgen::Integrator::description();
     desc.setDescription("Cuba generic integration algorithm");
     desc.add("ncomp", 1).setDescription("number of components of the integrand");
-    desc.add("nvec", 1).setDescription("number of samples received by the integrand");
+    desc.add("nvec", 1).setDescription("maximal number of samples received by the integrand in one call");
     desc.add("epsrel", 1.e-3).setDescription("requested relative accuracy");
     desc.add("epsabs", 1.e-12).setDescription("requested absolute accuracy");
     desc.add("mineval", 0).setDescription("minimum number of integrand evaluations required");
     desc.add("maxeval", 50'000).setDescription("(approximate) maximum number of integrand evaluations allowed");
+    desc.add("numCores", -1)
+        .setDescription(
+            "number of worker processes for the integrand evaluation (0 = serial, -1 = CUBACORES environment variable "
+            "or number of idle cores)");
+    desc.add("maxCorePoints", 10'000).setDescription("maximal number of points sent to a worker process in one batch");
     return desc;
   }
 
-  int cuba_integrand(const int* ndim, const double xx[], const int* /*ncomp*/, double ff[], void* /*userdata*/) {
-    if (!Integrator::gIntegrand)
-      throw CG_FATAL("cuba_integrand") << "Integrand not set for the Cuba algorithm!";
+  int Integrator::integrand(const int* ndim,
+                            const double xx[],
+                            const int* ncomp,
+                            double ff[],
+                            void* userdata,
+                            const int* nvec,
+                            const int* /*core*/) {
+    auto* integrator = static_cast<Integrator*>(userdata);
+    if (!integrator || !integrator->integrand_)
+      throw CG_FATAL("cuba:Integrator:integrand") << "Integrand not set for the Cuba algorithm!";
+    auto& function = integrator->worker_integrand_ ? *integrator->worker_integrand_ : *integrator->integrand_;
     //TODO: handle the non-[0,1] ranges
-    ff[0] = Integrator::gIntegrand->eval(std::vector<double>(xx, xx + *ndim));
+    const size_t num_points = *nvec, num_components = *ncomp;
+    if (num_points == 1) {  // no batching overhead for single point evaluations
+      integrator->points_.assign(xx, xx + *ndim);
+      ff[0] = function.eval(integrator->points_);
+    } else {
+      integrator->points_.assign(xx, xx + num_points * (*ndim));
+      function.evalBatch(integrator->points_, integrator->weights_);
+      for (size_t i = 0; i < num_points; ++i)
+        ff[i * num_components] = integrator->weights_[i];
+    }
+    for (size_t i = 0; i < num_points; ++i)  // only the first component is filled
+      std::fill(ff + i * num_components + 1, ff + (i + 1) * num_components, 0.);
     return 0;
   }
+
+  void Integrator::initialiseWorker(void* userdata, const int* core) {
+    auto* integrator = static_cast<Integrator*>(userdata);
+    if (::getpid() == integrator->master_pid_)  // master process keeps evaluating the original integrand
+      return;
+    try {
+      integrator->worker_integrand_ = integrator->integrand_->clone();
+      CG_DEBUG("cuba:Integrator:initialiseWorker") << "Integrand cloned for worker process #" << *core << ".";
+    } catch (const Exception& exc) {  // worker process will evaluate its (forked) copy of the original integrand
+      CG_DEBUG("cuba:Integrator:initialiseWorker")
+          << "Failed to clone the integrand for worker process #" << *core << ".\n\t" << exc.message();
+    }
+  }
+
+  void Integrator::finaliseWorker(void* userdata, const int* /*core*/) {
+    static_cast<Integrator*>(userdata)->worker_integrand_.reset();
+  }
 }  // namespace cepgen::cuba
@@ -50,10 +50,10 @@ namespace cepgen::cuba {
       int neval, fail, nregions;
       double integral, error, prob;
 
-      Suave(gIntegrand->size(),
+      Suave(ndim(),
             ncomp_,
-            cuba_integrand,
-            nullptr,
+            reinterpret_cast<integrand_t>(&Integrator::integrand),
+            this,  // user data
             nvec_,
             epsrel_,
             epsabs_,
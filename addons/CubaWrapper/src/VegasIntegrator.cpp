@@ -51,10 +51,10 @@ namespace cepgen::cuba {
       int neval, fail;
       double integral, error, prob;
 
-      Vegas(gIntegrand->size(),
+      Vegas(ndim(),
             ncomp_,
-            cuba_integrand,
-            nullptr,
+            reinterpret_cast<integrand_t>(&Integrator::integrand),
+            this,  // user data
             nvec_,
             epsrel_,
             epsabs_,
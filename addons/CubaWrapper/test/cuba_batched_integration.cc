@@ -0,0 +1,64 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/Generator.h"
+#include "CepGen/Integration/Integrator.h"
+#include "CepGen/Modules/IntegratorFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Test.h"
+#include "CepGen/Utils/Value.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  vector<string> integrators;
+  int batch_size;
+
+  cepgen::initialise();
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("integrator,i",
+                           "type of integrator used",
+                           &integrators,
+                           vector<string>{"cuba_vegas", "cuba_suave", "cuba_divonne", "cuba_cuhre"})
+      .addOptionalArgument("batch-size,b", "maximal number of points evaluated in one call", &batch_size, 1000)
+      .parse();
+
+  const auto integrand = [](const vector<double>& vars) -> double {
+    return 1. / (1. - cos(vars.at(0)) * cos(vars.at(1)) * cos(vars.at(2))) / (M_PI * M_PI * M_PI);
+  };
+  const vector<cepgen::Limits> limits(3, cepgen::Limits{0., M_PI});
+
+  for (const auto& integrator_name : integrators) {
+    auto integrate = [&](int nvec) {  // no worker process, for a reproducible sampling
+      return cepgen::IntegratorFactory::get()
+          .build(integrator_name, cepgen::ParametersList().set("nvec", nvec).set("numCores", 0))
+          ->integrate(integrand, limits);
+    };
+    const auto res_unbatched = integrate(1), res_batched = integrate(batch_size);
+    CG_TEST_VALUES(res_unbatched, 1.3932039296856768591842462603255, 5., integrator_name + " unbatched result");
+    CG_TEST_EQUAL(static_cast<double>(res_unbatched),
+                  static_cast<double>(res_batched),
+                  integrator_name + " result independent of batch size");
+    CG_TEST_EQUAL(res_unbatched.uncertainty(),
+                  res_batched.uncertainty(),
+                  integrator_name + " uncertainty independent of batch size");
+  }
+  CG_TEST_SUMMARY;
+}
@@ -19,10 +19,12 @@
 #ifndef CepGenHepMC3_CepGenEvent_h
 #define CepGenHepMC3_CepGenEvent_h
 
+#include <HepMC3/Attribute.h>
 #include <HepMC3/GenEvent.h>
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace cepgen {
   class Event;
@@ -38,10 +40,17 @@ namespace HepMC3 {
     explicit operator cepgen::Event() const;     ///< Extract a CepGen Event object from a HepMC3 GenEvent object
     void dump() const;                           ///< Write the event content in the standard stream
     void merge(cepgen::Event&) const;            ///< Merge this event with another CepGen event record
+    /// Update the particles kinematics, identifiers, and statuses in place from another CepGen event
+    /// \return false if the event topology (particles roles and parentage) differs, and the event must be rebuilt
+    bool update(const cepgen::Event&);
 
   private:
     static constexpr double kTolerance = 1.e-6;
     std::unordered_map<unsigned short, std::shared_ptr<GenParticle> > cepgen_id_vs_hepmc_particle_;
+    std::vector<std::shared_ptr<GenParticle> > hepmc_particles_;  ///< HepMC particle (if any) per CepGen particle
+    std::shared_ptr<DoubleAttribute> alpha_s_, alpha_em_;         ///< Couplings values attributes
+    std::vector<int> topology_;                                   ///< Signature of the event topology
+    std::vector<int> other_topology_;                             ///< Buffer for the signature of an updating event
   };
 }  // namespace HepMC3
 #endif
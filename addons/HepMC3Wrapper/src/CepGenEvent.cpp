@@ -34,9 +34,24 @@
 
 using namespace HepMC3;
 
-CepGenEvent::CepGenEvent(const cepgen::Event& event) : GenEvent(Units::GEV, Units::MM) {
-  add_attribute("AlphaQCD", make_shared<DoubleAttribute>(event.metadata("alphaS")));
-  add_attribute("AlphaEM", make_shared<DoubleAttribute>(event.metadata("alphaEM")));
+namespace {
+  /// Build the signature of an event topology (particles roles and parentage)
+  void buildTopology(const cepgen::Particles& particles, std::vector<int>& topology) {
+    topology.clear();
+    for (const auto& cepgen_particle : particles) {
+      topology.emplace_back(static_cast<int>(cepgen_particle.role()));
+      topology.emplace_back(cepgen_particle.mothers().size());
+      topology.insert(topology.end(), cepgen_particle.mothers().begin(), cepgen_particle.mothers().end());
+    }
+  }
+}  // namespace
+
+CepGenEvent::CepGenEvent(const cepgen::Event& event)
+    : GenEvent(Units::GEV, Units::MM),
+      alpha_s_(make_shared<DoubleAttribute>(event.metadata("alphaS"))),
+      alpha_em_(make_shared<DoubleAttribute>(event.metadata("alphaEM"))) {
+  add_attribute("AlphaQCD", alpha_s_);
+  add_attribute("AlphaEM", alpha_em_);
 
   weights().push_back(1.);  // unweighted events
 
@@ -45,7 +60,10 @@ CepGenEvent::CepGenEvent(const cepgen::Event& event) : GenEvent(Units::GEV, Unit
   auto vertex_beam1 = make_shared<GenVertex>(origin), vertex_beam2 = make_shared<GenVertex>(origin),
        vertex_central_system = make_shared<GenVertex>(origin);
   size_t idx = 0;
-  for (const auto& cepgen_particle : event.particles()) {  // filling the particles content
+  const auto particles = event.particles();
+  buildTopology(particles, topology_);
+  hepmc_particles_.reserve(particles.size());
+  for (const auto& cepgen_particle : particles) {  // filling the particles content
     const auto& cepgen_momentum = cepgen_particle.momentum();
     const auto momentum =
         FourVector(cepgen_momentum.px(), cepgen_momentum.py(), cepgen_momentum.pz(), cepgen_momentum.energy());
@@ -53,6 +71,7 @@ CepGenEvent::CepGenEvent(const cepgen::Event& event) : GenEvent(Units::GEV, Unit
         make_shared<GenParticle>(momentum, cepgen_particle.integerPdgId(), static_cast<int>(cepgen_particle.status()));
     hepmc_particle->set_generated_mass(cepgen::PDG::get().mass(cepgen_particle.pdgId()));
     cepgen_id_vs_hepmc_particle_[idx] = hepmc_particle;
+    hepmc_particles_.emplace_back(hepmc_particle);
 
     switch (cepgen_particle.role()) {
       case cepgen::Particle::Role::IncomingBeam1:
@@ -77,12 +96,15 @@ CepGenEvent::CepGenEvent(const cepgen::Event& event) : GenEvent(Units::GEV, Unit
         break;
       case cepgen::Particle::Role::Intermediate:  // skip the two-parton system and propagate the parentage
         central_system_id = idx;
+        hepmc_particles_.back().reset();
         continue;
       case cepgen::Particle::Role::CentralSystem:
       default: {
         const auto& mothers = cepgen_particle.mothers();
-        if (mothers.empty())
+        if (mothers.empty()) {
+          hepmc_particles_.back().reset();
           continue;  // skip disconnected lines
+        }
         // check if particle is connected to the two-parton system
         if (const auto m1 = *mothers.begin(), m2 = mothers.size() > 1 ? *mothers.rbegin() : -1;  // get mother(s) id(s)
             m1 == central_system_id ||
@@ -114,6 +136,26 @@ CepGenEvent::CepGenEvent(const cepgen::Event& event) : GenEvent(Units::GEV, Unit
   add_vertex(vertex_central_system);
 }
 
+bool CepGenEvent::update(const cepgen::Event& event) {
+  const auto particles = event.particles();
+  if (buildTopology(particles, other_topology_); other_topology_ != topology_)
+    return false;
+  alpha_s_->set_value(event.metadata("alphaS"));
+  alpha_em_->set_value(event.metadata("alphaEM"));
+  size_t idx = 0;
+  for (const auto& cepgen_particle : particles) {
+    if (const auto& hepmc_particle = hepmc_particles_.at(idx++); hepmc_particle) {
+      const auto& cepgen_momentum = cepgen_particle.momentum();
+      hepmc_particle->set_momentum(
+          FourVector(cepgen_momentum.px(), cepgen_momentum.py(), cepgen_momentum.pz(), cepgen_momentum.energy()));
+      hepmc_particle->set_pid(cepgen_particle.integerPdgId());
+      hepmc_particle->set_status(static_cast<int>(cepgen_particle.status()));
+      hepmc_particle->set_generated_mass(cepgen::PDG::get().mass(cepgen_particle.pdgId()));
+    }
+  }
+  return true;
+}
+
 CepGenEvent::operator cepgen::Event() const {
   cepgen::Event event;
   const auto convert_particle = [](const GenParticle& hepmc_particle, const cepgen::Particle::Role cepgen_role) {
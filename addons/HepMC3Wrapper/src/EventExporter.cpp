@@ -59,11 +59,13 @@ namespace cepgen::hepmc3 {
     }
 
     bool operator<<(const Event& cg_event) override {
-      CepGenEvent event(cg_event);
-      event.set_cross_section(cross_section_);
-      event.set_run_info(run_info_);
-      event.set_event_number(event_num_++);
-      output_->write_event(event);
+      if (!event_ || !event_->update(cg_event)) {  // event record only rebuilt if its topology changed
+        event_ = std::make_unique<CepGenEvent>(cg_event);
+        event_->set_cross_section(cross_section_);
+        event_->set_run_info(run_info_);
+      }
+      event_->set_event_number(event_num_++);
+      output_->write_event(*event_);
       return !output_->failed();
     }
     void setCrossSection(const Value& cross_section) override {
@@ -74,6 +76,7 @@ namespace cepgen::hepmc3 {
     const std::unique_ptr<T> output_;                       ///< writer object
     const std::shared_ptr<GenCrossSection> cross_section_;  ///< generator cross-section and error
     const std::shared_ptr<GenRunInfo> run_info_;            ///< auxiliary information on run
+    std::unique_ptr<CepGenEvent> event_;                    ///< event record, reused while its topology is unchanged
   };
 }  // namespace cepgen::hepmc3
 template <typename T>
@@ -25,7 +25,6 @@
 #include "CepGen/Event/Event.h"
 #include "CepGen/EventFilter/EventImporter.h"
 #include "CepGen/Modules/EventImporterFactory.h"
-#include "CepGen/Utils/Collections.h"
 #include "CepGen/Utils/String.h"
 #include "CepGenHepMC3/CepGenEvent.h"
 
@@ -92,13 +91,13 @@ namespace cepgen::hepmc3 {
           part.addMother(evt[moth.first - 1]);
         if (moth.second > 0)
           part.addMother(evt[moth.second - 1]);
-        if (utils::contains(part.mothers(), id_ip1)) {
+        if (part.mothers().count(id_ip1) > 0) {
           if (evt[Particle::Role::OutgoingBeam1].empty() && hepeup.IDUP.at(i) == static_cast<long>(pdg_ip1))
             part.setRole(Particle::Role::OutgoingBeam1);
           else
             part.setRole(Particle::Role::Parton1);
         }
-        if (utils::contains(part.mothers(), id_ip2)) {
+        if (part.mothers().count(id_ip2) > 0) {
           if (evt[Particle::Role::OutgoingBeam2].empty() && hepeup.IDUP.at(i) == static_cast<long>(pdg_ip2))
             part.setRole(Particle::Role::OutgoingBeam2);
           else
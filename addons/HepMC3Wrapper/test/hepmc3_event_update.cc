@@ -0,0 +1,84 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <HepMC3/Attribute.h>
+#include <HepMC3/GenParticle.h>
+
+#include "CepGen/Event/Event.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Test.h"
+#include "CepGenHepMC3/CepGenEvent.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  cepgen::initialise();
+  cepgen::ArgumentsParser(argc, argv).parse();
+
+  // build a trivial event with a given central system multiplicity, and kinematics depending on a shift
+  const auto build_event = [](size_t num_central_particles, double shift) {
+    auto event = cepgen::Event::minimal(num_central_particles);
+    for (size_t i = 0; i < event.size(); ++i) {
+      auto& part = event[i];
+      switch (part.role()) {
+        case cepgen::Particle::Role::IncomingBeam1:
+        case cepgen::Particle::Role::IncomingBeam2:
+        case cepgen::Particle::Role::OutgoingBeam1:
+        case cepgen::Particle::Role::OutgoingBeam2:
+          part.setPdgId(2212);
+          break;
+        case cepgen::Particle::Role::CentralSystem:
+          part.setPdgId(shift > 0. ? 11 : 13);
+          break;
+        default:
+          part.setPdgId(22);
+          break;
+      }
+      part.setMomentum(cepgen::Momentum::fromPxPyPzE(shift * i, -shift, 10. * i + shift, 100. * (i + 1) + shift));
+    }
+    event.metadata["alphaS"] = 0.1 + shift;
+    event.metadata["alphaEM"] = 1. / 137. + shift;
+    return event;
+  };
+
+  HepMC3::CepGenEvent updated_event(build_event(2, 0.));
+  const auto new_event = build_event(2, 0.5);
+  CG_TEST(updated_event.update(new_event), "event with an unchanged topology updated in place");
+
+  const HepMC3::CepGenEvent rebuilt_event(new_event);
+  const auto &updated_particles = updated_event.particles(), &rebuilt_particles = rebuilt_event.particles();
+  CG_TEST_EQUAL(updated_particles.size(), rebuilt_particles.size(), "particles multiplicity after update");
+  bool same_particles = updated_particles.size() == rebuilt_particles.size();
+  for (size_t i = 0; same_particles && i < updated_particles.size(); ++i) {
+    const auto &updated_particle = *updated_particles.at(i), &rebuilt_particle = *rebuilt_particles.at(i);
+    same_particles = updated_particle.momentum() == rebuilt_particle.momentum() &&
+                     updated_particle.pid() == rebuilt_particle.pid() &&
+                     updated_particle.status() == rebuilt_particle.status() &&
+                     updated_particle.generated_mass() == rebuilt_particle.generated_mass();
+  }
+  CG_TEST(same_particles, "particles content after update identical to a full rebuild");
+  for (const auto& attribute : {"AlphaQCD", "AlphaEM"})
+    CG_TEST_EQUAL(updated_event.attribute<HepMC3::DoubleAttribute>(attribute)->value(),
+                  rebuilt_event.attribute<HepMC3::DoubleAttribute>(attribute)->value(),
+                  "couplings attribute "s + attribute + " after update");
+
+  CG_TEST(!updated_event.update(build_event(3, 0.)), "topology change requests a rebuild");
+
+  CG_TEST_SUMMARY;
+}
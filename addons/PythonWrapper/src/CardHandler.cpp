@@ -140,9 +140,9 @@ namespace cepgen::python {
           log << "\n\t" << ln;
       });
 
-      // timekeeper definition (currently, does not parse the object, just check its presence)
-      if (!plist_.get<ParametersList>("timer").empty())
-        runParameters()->setTimeKeeper(new utils::TimeKeeper);
+      // timekeeper definition (only the latency histograms flag is parsed, otherwise just check its presence)
+      if (const auto timer = plist_.get<ParametersList>("timer"); !timer.empty())
+        runParameters()->setTimeKeeper(new utils::TimeKeeper(timer.get<bool>("histograms", false)));
 
       // general particles definition
       if (const auto mcd_file = plist_.get<std::string>("mcdFile"); !mcd_file.empty())
@@ -22,6 +22,9 @@
 #include <TFile.h>
 #include <TTree.h>
 
+#include <unordered_map>
+#include <vector>
+
 #include "CepGen/Event/Event.h"
 
 namespace ROOT {
@@ -57,35 +60,39 @@ namespace ROOT {
   };
 
   /// All useful information about a generated event
+  /// \note Particles arrays are stored as variable-length (npart-indexed) branches, backed by buffers growing with the
+  ///  largest particles multiplicity encountered
   class CepGenEvent {
   public:
-    CepGenEvent() { clear(); }
+    CepGenEvent() {
+      reserve(MIN_PART);
+      clear();
+    }
 
-    // book a large enough number to allow the large multiplicity of excited proton fragmentation products
-    static constexpr size_t MAX_PART = 5000;            ///< Maximal particles multiplicity in event
+    static constexpr size_t MIN_PART = 64;              ///< Initial particles multiplicity booked in the buffers
     static constexpr const char* TREE_NAME = "events";  ///< Output tree name
 
     static CepGenEvent load(TFile*, const std::string& events_tree = TREE_NAME);
     static CepGenEvent load(const std::string&, const std::string& events_tree = TREE_NAME);
 
-    cepgen::Event::EventMetadata metadata;
-    float gen_time{-1.};        ///< Event generation time
-    float tot_time{-1.};        ///< Total event generation time
-    float weight{-1.};          ///< Event weight
-    int np{0};                  ///< Particles multiplicity in the event
-    double pt[MAX_PART];        ///< Particles transverse momentum
-    double eta[MAX_PART];       ///< Particles pseudo-rapidity
-    double phi[MAX_PART];       ///< Particles azimuthal angle
-    double rapidity[MAX_PART];  ///< Particles rapidity
-    double E[MAX_PART];         ///< Particles energy, in GeV
-    double m[MAX_PART];         ///< Particles mass, in GeV/c\f${}^2\f$
-    double charge[MAX_PART];    ///< Particles charges, in e
-    int pdg_id[MAX_PART];       ///< Integer particles PDG id
-    int parent1[MAX_PART];      ///< First particles mother
-    int parent2[MAX_PART];      ///< Last particles mother
-    int stable[MAX_PART];       ///< Whether the particle must decay or not
-    int role[MAX_PART];         ///< Particles role in the event
-    int status[MAX_PART];       ///< Integer status code
+    std::unordered_map<std::string, float> metadata;
+    float gen_time{-1.};           ///< Event generation time
+    float tot_time{-1.};           ///< Total event generation time
+    float weight{-1.};             ///< Event weight
+    int np{0};                     ///< Particles multiplicity in the event
+    std::vector<double> pt;        ///< Particles transverse momentum
+    std::vector<double> eta;       ///< Particles pseudo-rapidity
+    std::vector<double> phi;       ///< Particles azimuthal angle
+    std::vector<double> rapidity;  ///< Particles rapidity
+    std::vector<double> E;         ///< Particles energy, in GeV
+    std::vector<double> m;         ///< Particles mass, in GeV/c\f${}^2\f$
+    std::vector<double> charge;    ///< Particles charges, in e
+    std::vector<int> pdg_id;       ///< Integer particles PDG id
+    std::vector<int> parent1;      ///< First particles mother
+    std::vector<int> parent2;      ///< Last particles mother
+    std::vector<int> stable;       ///< Whether the particle must decay or not
+    std::vector<int> role;         ///< Particles role in the event
+    std::vector<int> status;       ///< Integer status code
 
     void clear();                                ///< Reinitialise the event content
     TTree* tree() const { return tree_.get(); }  ///< Retrieve the ROOT tree
@@ -102,9 +109,15 @@ namespace ROOT {
     bool next(cepgen::Event&);                               ///< Read the next event in the file
 
   private:
+    /// Apply an operation on all particles arrays, along with their branch name
+    template <typename F>
+    void forEachArray(F&&);
+    /// Grow the particles buffers to hold a given multiplicity, and bind the branches to their new location
+    void reserve(size_t num_particles);
+
     std::shared_ptr<TTree> tree_;  ///< Tree for which the event is booked
     std::unique_ptr<TFile> file_;
-    bool tree_attached_{false};
+    bool tree_attached_{false};  ///< Are the tree branches bound to the event buffers?
     unsigned long long num_read_events_{0ull};
   };
 }  // namespace ROOT
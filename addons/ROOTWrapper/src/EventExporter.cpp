@@ -59,6 +59,11 @@ namespace cepgen::root {
       desc.add("filename", "output.root"s).setDescription("Output filename");
       desc.add("compress", false).setDescription("Compress the event content? (merge down two-parton system)");
       desc.add("autoFilename", false).setDescription("automatically generate the output filename");
+      desc.add("basketSize", 32000).setDescription("size of the events tree branches baskets, in bytes");
+      desc.add("autoFlush", -30000000)
+          .setDescription("events tree auto-flush period (number of entries if positive, bytes if negative)");
+      desc.add("compressionSettings", -1)
+          .setDescription("output file compression settings (100 * algorithm + level), or -1 for the ROOT default");
       return desc;
     }
 
@@ -80,8 +85,12 @@ namespace cepgen::root {
         if (file_.reset(TFile::Open(filename.data(), "recreate")); !file_->IsOpen())
           throw CG_FATAL("root:EventExporter") << "Failed to create the output file!";
       }
+      if (const auto compression = steer<int>("compressionSettings"); compression >= 0)
+        file_->SetCompressionSettings(compression);  // inherited by the branches created below
       run_tree_.create();
       event_tree_.create();
+      event_tree_.tree()->SetAutoFlush(steer<int>("autoFlush"));
+      event_tree_.tree()->SetBasketSize("*", steer<int>("basketSize"));
       run_tree_.litigious_events = 0;
       if (runParameters().hasProcess()) {
         run_tree_.sqrt_s = runParameters().kinematics().incomingBeams().sqrtS();
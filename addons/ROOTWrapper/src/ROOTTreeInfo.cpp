@@ -16,6 +16,12 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <TBranch.h>
+#include <TLeaf.h>
+
+#include <algorithm>
+#include <type_traits>
+
 #include "CepGen/Core/Exception.h"
 #include "CepGenRoot/ROOTTreeInfo.h"
 
@@ -102,11 +108,33 @@ CepGenEvent CepGenEvent::load(const std::string& filename, const std::string& ev
 
 void CepGenEvent::clear() {
   gen_time = tot_time = 0.;
-  np = 0;
-  for (size_t i = 0; i < MAX_PART; ++i) {
-    pt[i] = eta[i] = phi[i] = rapidity[i] = E[i] = m[i] = charge[i] = 0.;
-    pdg_id[i] = parent1[i] = parent2[i] = stable[i] = role[i] = status[i] = 0;
-  }
+  np = 0;  // particles buffers are kept allocated, and only their first np entries are stored
+}
+
+template <typename F>
+void CepGenEvent::forEachArray(F&& op) {
+  op("role", role);
+  op("pt", pt);
+  op("eta", eta);
+  op("phi", phi);
+  op("rapidity", rapidity);
+  op("E", E);
+  op("m", m);
+  op("charge", charge);
+  op("pdg_id", pdg_id);
+  op("parent1", parent1);
+  op("parent2", parent2);
+  op("stable", stable);
+  op("status", status);
+}
+
+void CepGenEvent::reserve(size_t num_particles) {
+  if (num_particles <= pt.size())
+    return;
+  const auto capacity = std::max({num_particles, 2 * pt.size(), MIN_PART});
+  forEachArray([&capacity](const char*, auto& buffer) { buffer.resize(capacity); });
+  if (tree_ && tree_attached_)  // buffers were relocated; update the branches addresses
+    forEachArray([this](const char* name, auto& buffer) { tree_->SetBranchAddress(name, buffer.data()); });
 }
 
 void CepGenEvent::create() {
@@ -114,42 +142,24 @@ void CepGenEvent::create() {
       !tree_)
     throw CG_FATAL("CepGenEvent:create") << "Failed to create the events TTree!";
   tree_->Branch("npart", &np, "npart/I");
-  tree_->Branch("role", role, "role[npart]/I");
-  tree_->Branch("pt", pt, "pt[npart]/D");
-  tree_->Branch("eta", eta, "eta[npart]/D");
-  tree_->Branch("phi", phi, "phi[npart]/D");
-  tree_->Branch("rapidity", rapidity, "rapidity[npart]/D");
-  tree_->Branch("E", E, "E[npart]/D");
-  tree_->Branch("m", m, "m[npart]/D");
-  tree_->Branch("charge", charge, "charge[npart]/D");
-  tree_->Branch("pdg_id", pdg_id, "pdg_id[npart]/I");
-  tree_->Branch("parent1", parent1, "parent1[npart]/I");
-  tree_->Branch("parent2", parent2, "parent2[npart]/I");
-  tree_->Branch("stable", stable, "stable[npart]/I");
-  tree_->Branch("status", status, "status[npart]/I");
+  forEachArray([this](const char* name, auto& buffer) {
+    const auto* leaf_type = std::is_same_v<typename std::decay_t<decltype(buffer)>::value_type, double> ? "D" : "I";
+    tree_->Branch(name, buffer.data(), (std::string(name) + "[npart]/" + leaf_type).data());
+  });
   tree_->Branch("weight", &weight, "weight/F");
   tree_->Branch("generation_time", &gen_time, "generation_time/F");
   tree_->Branch("total_time", &tot_time, "total_time/F");
   tree_->Branch("metadata", &metadata);
+  tree_attached_ = true;
 }
 
 void CepGenEvent::attach() {
   if (!tree_)
     throw CG_FATAL("CepGenEvent:attach") << "Failed to attach to the events TTree!";
+  if (const auto* npart_leaf = tree_->GetLeaf("npart"); npart_leaf)  // largest multiplicity stored in the tree
+    reserve(std::max(npart_leaf->GetMaximum(), 0));
   tree_->SetBranchAddress("npart", &np);
-  tree_->SetBranchAddress("role", role);
-  tree_->SetBranchAddress("pt", pt);
-  tree_->SetBranchAddress("eta", eta);
-  tree_->SetBranchAddress("phi", phi);
-  tree_->SetBranchAddress("rapidity", rapidity);
-  tree_->SetBranchAddress("E", E);
-  tree_->SetBranchAddress("m", m);
-  tree_->SetBranchAddress("charge", charge);
-  tree_->SetBranchAddress("pdg_id", pdg_id);
-  tree_->SetBranchAddress("parent1", parent1);
-  tree_->SetBranchAddress("parent2", parent2);
-  tree_->SetBranchAddress("stable", stable);
-  tree_->SetBranchAddress("status", status);
+  forEachArray([this](const char* name, auto& buffer) { tree_->SetBranchAddress(name, buffer.data()); });
   tree_->SetBranchAddress("weight", &weight);
   tree_->SetBranchAddress("generation_time", &gen_time);
   tree_->SetBranchAddress("total_time", &tot_time);
@@ -165,8 +175,10 @@ void CepGenEvent::fill(const cepgen::Event& ev, bool compress) {
   gen_time = ev.metadata("time:generation");
   tot_time = ev.metadata("time:total");
   weight = ev.metadata("weight");
+  const auto particles = compress ? ev.compress().particles() : ev.particles();
+  reserve(particles.size());
   np = 0;
-  for (const auto& part : compress ? ev.compress().particles() : ev.particles()) {  // loop over all particles in event
+  for (const auto& part : particles) {  // loop over all particles in event
     const auto& mom = part.momentum();
     rapidity[np] = mom.rapidity();
     pt[np] = mom.pt();
@@ -183,7 +195,9 @@ void CepGenEvent::fill(const cepgen::Event& ev, bool compress) {
     role[np] = static_cast<int>(part.role());
     np++;
   }
-  metadata = ev.metadata;
+  metadata.clear();
+  for (const auto& key : ev.metadata.keys())
+    metadata[key] = ev.metadata(key);
   tree_->Fill();
   clear();
 }
@@ -203,13 +217,15 @@ void CepGenEvent::attach(const std::string& filename, const std::string& events_
 bool CepGenEvent::next(cepgen::Event& ev) {
   if (!tree_attached_)
     attach();
+  if (auto* npart_branch = tree_->GetBranch("npart"); npart_branch && npart_branch->GetEntry(num_read_events_) > 0)
+    reserve(np);  // ensure the particles buffers may hold this entry before reading it
   if (tree_->GetEntry(num_read_events_++) <= 0)
     return false;
   ev.clear();
   ev.metadata["time:generation"] = gen_time;
   ev.metadata["time:total"] = tot_time;
   ev.metadata["weight"] = weight;
-  for (unsigned short i = 0; i < np; ++i) {  // first loop to populate the particle content
+  for (int i = 0; i < np; ++i) {  // first loop to populate the particle content
     cepgen::Particle part;
     part.setRole(static_cast<cepgen::Particle::Role>(role[i]));
     part.setPdgId(pdg_id[i]);
@@ -217,12 +233,12 @@ bool CepGenEvent::next(cepgen::Event& ev) {
     part.setMomentum(cepgen::Momentum::fromPtEtaPhiE(pt[i], eta[i], phi[i], E[i]));
     ev.addParticle(part);
   }
-  for (unsigned short i = 0; i < np; ++i) {  // second loop to associate the parentage
+  for (int i = 0; i < np; ++i) {  // second loop to associate the parentage
     auto& part = ev[i];
     if (parent1[i] > 0)
       part.addMother(ev[parent1[i]]);
     if (parent2[i] > parent1[i])
-      for (unsigned short j = parent1[i] + 1; j <= parent2[i]; ++j)
+      for (int j = parent1[i] + 1; j <= parent2[i]; ++j)
         part.addMother(ev[j]);
   }
   return true;
@@ -34,13 +34,14 @@ using namespace std::string_literals;
 int main(int argc, char* argv[]) {
   bool keep_file;
   string proc_name, tmp_filename;
-  int num_gen;
+  int num_gen, num_particles;
   cepgen::ArgumentsParser(argc, argv)
       .addOptionalArgument("keep-file,k", "keep the output TTree", &keep_file, false)
       .addOptionalArgument("process,p", "process to generate", &proc_name, "lpair")
       .addOptionalArgument(
           "filename,f", "temporary filename", &tmp_filename, fs::temp_directory_path() / "cepgen_test.root")
       .addOptionalArgument("num-gen,n", "number of events to generate", &num_gen, 10)
+      .addOptionalArgument("num-particles,m", "particles multiplicity of the large event", &num_particles, 6000)
       .parse();
 
   if (!cepgen::utils::isWriteable(tmp_filename))
@@ -79,6 +80,30 @@ int main(int argc, char* argv[]) {
       CG_TEST(evt_info.tree()->GetEntriesFast() == num_gen, "number of events generated");
   }
 
+  {  // round-trip of an event with a particles multiplicity above the former fixed-size buffers capacity
+    auto event = cepgen::Event::minimal(num_particles);
+    for (auto& part : event[cepgen::Particle::Role::CentralSystem])
+      part.get().setPdgId(13).setMomentum(cepgen::Momentum::fromPtEtaPhiE(1. + part.get().id() * 1.e-3, 0., 0., 5.));
+    {  // tree writing part; the tree is released before its file
+      std::unique_ptr<TFile> file(TFile::Open(tmp_filename.c_str(), "recreate"));
+      ROOT::CepGenEvent evt_info;
+      evt_info.create();
+      evt_info.fill(event);
+      file->Write();
+    }
+    std::unique_ptr<TFile> file(TFile::Open(tmp_filename.c_str()));
+    ROOT::CepGenEvent evt_info;
+    evt_info.attach(file.get());
+    cepgen::Event read_event;
+    CG_TEST(evt_info.next(read_event), "large event read back");
+    CG_TEST_EQUAL(read_event.size(), event.size(), "large event particles multiplicity");
+    const auto &last_part = event[event.size() - 1], &last_read_part = read_event[read_event.size() - 1];
+    CG_TEST_EQUAL(last_read_part.integerPdgId(), last_part.integerPdgId(), "large event last particle PDG id");
+    CG_TEST_EQUIV(last_read_part.momentum().pt(), last_part.momentum().pt(), "large event last particle pt");
+    CG_TEST(last_read_part.mothers() == last_part.mothers(), "large event last particle parentage");
+    CG_TEST(!evt_info.next(read_event), "single event in the tree");
+  }
+
   if (!keep_file)  // tree removal part
     CG_TEST(fs::remove(tmp_filename), "removal the temporary file \"" + tmp_filename + "\".");
 
@@ -31,6 +31,9 @@ endif()
 #--- searching for GSL
 find_package(GSL COMPONENTS gsl REQUIRED)
 list(APPEND CEPGEN_CORE_EXT GSL::gsl)
+#--- threading library for multithreaded event generation
+find_package(Threads REQUIRED)
+list(APPEND CEPGEN_CORE_EXT Threads::Threads)
 #--- either use GSL's CBLAS or OpenBLAS implementation
 find_library(OPENBLAS_LIB openblas HINTS $ENV{OPENBLAS_DIR} PATH_SUFFIXES lib)
 if(OPENBLAS_LIB)
@@ -8,4 +8,6 @@
 from .containers_cff import Parameters
 
 
-timer = Parameters()
+timer = Parameters(
+    histograms = False,  # also fill fixed-size latency histograms (for p50/p99 estimates)
+)
@@ -312,6 +312,8 @@ void LpairHandler::init() {
   registerGenerationParameter<int>("NCSG"s, "Number of points to probe", "numPoints"s);
   registerGenerationParameter<int>("NGEN"s, "Number of events to generate", "maxgen"s);
   registerGenerationParameter<int>("NPRN"s, "Number of events before printout", "printEvery"s);
+  registerGenerationParameter<std::string>("GRDC"s, "Integration/generation grids cache directory", "gridCache"s);
+  registerGenerationParameter<int>("EXPB"s, "Number of events buffered for asynchronous export", "exportBufferSize"s);
 
   //-------------------------------------------------------------------------------------------
   // Process-specific parameters
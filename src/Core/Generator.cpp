@@ -17,19 +17,24 @@
  */
 
 #include <chrono>
+#include <future>
+#include <mutex>
 
 #include "CepGen/Cards/Handler.h"
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Core/GeneratorWorker.h"
 #include "CepGen/Core/RunParameters.h"
+#include "CepGen/EventFilter/EventExportPipeline.h"
 #include "CepGen/EventFilter/EventExporter.h"
 #include "CepGen/EventFilter/EventModifier.h"
 #include "CepGen/Generator.h"
+#include "CepGen/Integration/GridCache.h"
 #include "CepGen/Integration/Integrator.h"
 #include "CepGen/Integration/ProcessIntegrand.h"
 #include "CepGen/Modules/CardsHandlerFactory.h"
 #include "CepGen/Modules/GeneratorWorkerFactory.h"
 #include "CepGen/Modules/IntegratorFactory.h"
+#include "CepGen/Modules/RandomGeneratorFactory.h"
 #include "CepGen/Process/Process.h"
 #include "CepGen/Utils/String.h"
 #include "CepGen/Utils/TimeKeeper.h"
@@ -48,13 +53,17 @@ Generator::Generator(bool safe_mode) : parameters_(new RunParameters) {
 Generator::Generator(RunParameters* run_parameters) : parameters_(run_parameters) {}
 
 Generator::~Generator() {
+  export_pipeline_.reset();  // export all events still buffered before releasing the exporters
   if (parameters_->timeKeeper())
     CG_INFO("Generator:destructor") << parameters_->timeKeeper()->summary();
 }
 
 void Generator::clearRun() {
   CG_DEBUG("Generator:clearRun") << "Run is set to be cleared.";
-  worker_ = GeneratorWorkerFactory::get().build(parameters_->generation().parameters().get<ParametersList>("worker"));
+  export_pipeline_.reset();
+  worker_ = buildWorker();
+  secondary_workers_.clear();
+  grid_cache_.reset();
   CG_DEBUG("Generator:clearRun") << "Initialised a generator worker with parameters: " << worker_->parameters() << ".";
   // destroy and recreate the integrator instance
   resetIntegrator();
@@ -66,6 +75,24 @@ void Generator::clearRun() {
   initialised_ = false;
 }
 
+std::unique_ptr<GeneratorWorker> Generator::buildWorker(size_t thread_id) const {
+  auto worker_params = parameters_->generation().parameters().get<ParametersList>("worker");
+  if (thread_id > 0 && worker_) {
+    if (const auto& master_params = worker_->parameters(); master_params.has<ParametersList>("randomGenerator")) {
+      // with the engine defaults, e.g. the stream index of counter-based generators
+      auto rng_params = RandomGeneratorFactory::get()
+                            .describeParameters(master_params.get<ParametersList>("randomGenerator"))
+                            .parameters();
+      if (rng_params.has<unsigned long long>("stream"))  // counter-based generator; use an independent stream
+        rng_params.set<unsigned long long>("stream", rng_params.get<unsigned long long>("stream") + thread_id);
+      else  // shift the seed used by the master worker to decorrelate the random numbers streams
+        rng_params.set<unsigned long long>("seed", rng_params.get<unsigned long long>("seed") + thread_id);
+      worker_params.set("randomGenerator", rng_params);
+    }
+  }
+  return GeneratorWorkerFactory::get().build(worker_params);
+}
+
 void Generator::parseRunParameters(const std::string& filename) {
   setRunParameters(CardsHandlerFactory::get().buildFromFilename(filename)->parseFile(filename).runParameters());
 }
@@ -83,6 +110,7 @@ RunParameters& Generator::runParameters() {
 }
 
 void Generator::setRunParameters(std::unique_ptr<RunParameters>& run_parameters) {
+  export_pipeline_.reset();  // previous exporters are about to be released
   parameters_ = std::move(run_parameters);
 }
 
@@ -163,7 +191,21 @@ void Generator::integrate() {
   if (!integrator_)
     throw CG_FATAL("Generator:integrate") << "No integrator object was declared for the generator!";
 
-  cross_section_ = integrator_->integrate(worker_->integrand());
+  if (const auto& grid_cache_path = parameters_->generation().gridCache(); !grid_cache_path.empty())
+    grid_cache_ = std::make_unique<GridCache>(grid_cache_path, *parameters_);
+  if (grid_cache_ && grid_cache_->load() && integrator_->setState(grid_cache_->integratorState())) {
+    cross_section_ = grid_cache_->crossSection();
+    CG_INFO("Generator:integrate") << "Integration grid and cross section retrieved from cache file '"
+                                   << grid_cache_->filename() << "'.";
+  } else {
+    cross_section_ = integrator_->integrate(worker_->integrand());
+    if (grid_cache_) {  // store the adapted integration grid for subsequent runs
+      grid_cache_->setCrossSection(cross_section_);
+      grid_cache_->setIntegratorState(integrator_->state());
+      grid_cache_->setWorkerState({});  // generation grid is to be recomputed from the new integration grid
+      grid_cache_->store();
+    }
+  }
 
   CG_DEBUG("Generator:integrate") << "Computed cross section: (" << cross_section_ << ") pb.";
 
@@ -186,7 +228,31 @@ void Generator::initialise() {
 
   // prepare the run parameters for event generation
   parameters_->initialiseModules();
+  const auto grid_restored = grid_cache_ && worker_->setState(grid_cache_->workerState());
+  if (grid_restored)
+    CG_INFO("Generator:initialise") << "Generation grid retrieved from cache file '" << grid_cache_->filename() << "'.";
   worker_->initialise();
+  if (parameters_->generation().deferModification() && !worker_->integrand().deferredModification())
+    CG_WARNING("Generator:initialise")
+        << "Generator worker '" << worker_->parameters().name()
+        << "' does not support deferred event modifications. Event modification algorithms will be run on all trial "
+           "events.";
+  if (grid_cache_ && !grid_restored) {  // store the generation grid for subsequent runs
+    grid_cache_->setWorkerState(worker_->state());
+    grid_cache_->store();
+  }
+  export_pipeline_.reset();
+  if (const auto buffer_size = parameters_->generation().exportBufferSize();
+      buffer_size > 0 && !parameters_->eventExportersSequence().empty()) {  // export the events in background threads
+    std::vector<EventExporter*> exporters;
+    for (const auto& event_exporter : parameters_->eventExportersSequence())
+      exporters.emplace_back(event_exporter.get());
+    const auto backpressure = parameters_->generation().exportBackpressure() == "drop"
+                                  ? EventExportPipeline::Backpressure::drop
+                                  : EventExportPipeline::Backpressure::block;
+    export_pipeline_ = std::make_unique<EventExportPipeline>(exporters, buffer_size, backpressure);
+  }
+  worker_->setExportPipeline(export_pipeline_.get());
   initialised_ = true;
 }
 
@@ -220,7 +286,44 @@ void Generator::generate(size_t num_events, const std::function<void(const proc:
 
   const utils::Timer tmr;
 
-  worker_->generate(num_events, callback);  // launch the event generation
+  if (const auto num_threads = parameters_->generation().numThreads(); num_threads > 1) {
+    // prepare the additional workers, each with its own process clone and random numbers stream
+    const auto num_initialised_workers = secondary_workers_.size();
+    while (secondary_workers_.size() + 1 < num_threads) {
+      auto& worker = secondary_workers_.emplace_back(buildWorker(secondary_workers_.size() + 1));
+      worker->setRunParameters(parameters_.get());
+      worker->integrand().useLocalModules();  // event modification algorithms are not shared among threads
+      worker->integrand().setCrossSection(cross_section_);
+      worker->setIntegrator(integrator_.get());
+      worker->setExportPipeline(export_pipeline_.get());
+      // bypass the generation grid computation, as it is already available from the master worker
+      worker->setState(grid_cache_ ? grid_cache_->workerState() : worker_->state());
+    }
+    CG_INFO("Generator") << "Event generation will be performed using " << utils::s("thread", num_threads, true)
+                         << ".";
+    std::mutex storage_mutex;  // all workers feed the same events sink
+    worker_->setStorageMutex(&storage_mutex);
+    std::vector<std::future<void> > jobs;
+    for (size_t i = 0; i < secondary_workers_.size(); ++i) {
+      auto* worker = secondary_workers_.at(i).get();
+      worker->setStorageMutex(&storage_mutex);
+      const bool initialise = i >= num_initialised_workers;  // only prepare the newly-built workers
+      jobs.emplace_back(std::async(std::launch::async, [worker, initialise, &num_events, &callback]() {
+        if (initialise)
+          worker->initialise();
+        worker->generate(num_events, callback);
+      }));
+    }
+    worker_->generate(num_events, callback);  // master worker runs in the current thread
+    for (auto& job : jobs)
+      job.get();  // wait for all workers to finish, and propagate any exception raised in a worker thread
+    for (auto& worker : secondary_workers_)
+      worker->setStorageMutex(nullptr);
+    worker_->setStorageMutex(nullptr);
+  } else
+    worker_->generate(num_events, callback);  // launch the event generation
+  if (export_pipeline_)
+    export_pipeline_->flush();  // wait for all events to be exported
 
   const double generation_time = tmr.elapsed();
   const double rate_ms = (parameters_->numGeneratedEvents() > 0)
@@ -20,6 +20,7 @@
 #include "CepGen/Core/GeneratorWorker.h"
 #include "CepGen/Core/RunParameters.h"
 #include "CepGen/Event/Event.h"
+#include "CepGen/EventFilter/EventExportPipeline.h"
 #include "CepGen/EventFilter/EventExporter.h"
 #include "CepGen/Integration/Integrator.h"
 #include "CepGen/Integration/ProcessIntegrand.h"
@@ -53,8 +54,10 @@ void GeneratorWorker::generate(size_t num_events, const std::function<void(const
   if (!run_params_)
     throw CG_FATAL("GeneratorWorker:generate") << "No steering parameters specified!";
   callback_proc_ = callback;
+  num_events_target_ = num_events;
   while (run_params_->numGeneratedEvents() < num_events)
     next();
+  num_events_target_ = 0;
 }
 
 bool GeneratorWorker::storeEvent() const {
@@ -63,16 +66,25 @@ bool GeneratorWorker::storeEvent() const {
   if (!integrand_->process().hasEvent())
     return true;
 
+  std::unique_lock<std::mutex> lock;
+  if (storage_mutex_)  // events sink is shared with other workers
+    lock = std::unique_lock<std::mutex>(*storage_mutex_);
+  if (num_events_target_ > 0 && run_params_->numGeneratedEvents() >= num_events_target_)
+    return true;  // target already reached by another worker; drop this event
+
   const auto& event = integrand_->process().event();
   if (const auto num_events_generated = run_params_->numGeneratedEvents();
       (num_events_generated + 1) % run_params_->generation().printEvery() == 0)
     CG_DEBUG("GeneratorWorker:store") << utils::s("event", num_events_generated + 1, true) << " generated.";
   if (callback_proc_)
     callback_proc_(integrand_->process());
-  for (const auto& event_exporter : run_params_->eventExportersSequence())
-    if (!(*event_exporter << event))
-      return false;
-  const_cast<RunParameters*>(run_params_)->addGenerationTime(event.metadata("time:total"));
+  if (export_pipeline_)  // events are exported in background threads; export failures are counted by the pipeline
+    export_pipeline_->push(event);
+  else
+    for (const auto& event_exporter : run_params_->eventExportersSequence())
+      if (!(*event_exporter << event))
+        return false;
+  const_cast<RunParameters*>(run_params_)->addGenerationTime(event.metadata(Event::EventMetadata::TotalTime));
   return true;
 }
 
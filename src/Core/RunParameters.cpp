@@ -51,7 +51,7 @@ RunParameters::RunParameters(RunParameters& param)
       evt_exporters_(std::move(param.evt_exporters_)),
       taming_functions_(std::move(param.taming_functions_)),
       total_gen_time_(param.total_gen_time_),
-      num_gen_events_(param.num_gen_events_),
+      num_gen_events_(param.num_gen_events_.load()),
       integrator_(param.integrator_),
       generation_(param.generation_),
       timer_(std::move(param.timer_)) {}
@@ -59,7 +59,7 @@ RunParameters::RunParameters(RunParameters& param)
 RunParameters::RunParameters(const RunParameters& param)
     : SteeredObject(param),
       total_gen_time_(param.total_gen_time_),
-      num_gen_events_(param.num_gen_events_),
+      num_gen_events_(param.num_gen_events_.load()),
       integrator_(param.integrator_),
       generation_(param.generation_) {}
 
@@ -71,7 +71,7 @@ RunParameters& RunParameters::operator=(RunParameters param) {
   evt_exporters_ = std::move(param.evt_exporters_);
   taming_functions_ = std::move(param.taming_functions_);
   total_gen_time_ = param.total_gen_time_;
-  num_gen_events_ = param.num_gen_events_;
+  num_gen_events_ = param.num_gen_events_.load();
   integrator_ = param.integrator_;
   generation_ = param.generation_;
   timer_ = std::move(param.timer_);
@@ -224,8 +224,13 @@ namespace cepgen {
        << param.generation_.parameters().get<ParametersList>("worker").print(true) << "\n";
     if (param.generation_.numThreads() > 1)
       os << std::setw(wt) << "Number of threads" << param.generation_.numThreads() << "\n";
-    os << std::setw(wt) << "Number of points to try per bin" << param.generation_.numPoints() << "\n"
-       << std::setw(wt) << "Verbosity level " << utils::Logger::get().level() << "\n";
+    os << std::setw(wt) << "Number of points to try per bin" << param.generation_.numPoints() << "\n";
+    if (!param.generation_.gridCache().empty())
+      os << std::setw(wt) << "Grids cache directory" << param.generation_.gridCache() << "\n";
+    if (param.generation_.exportBufferSize() > 0)
+      os << std::setw(wt) << "Asynchronous export buffer" << utils::s("event", param.generation_.exportBufferSize())
+         << " (" << param.generation_.exportBackpressure() << " when full)\n";
+    os << std::setw(wt) << "Verbosity level " << utils::Logger::get().level() << "\n";
     const auto& kin = param.process().kinematics();
     const auto& beams = kin.incomingBeams();
     os << "\n"
@@ -296,7 +301,18 @@ RunParameters::Generation::Generation(const ParametersList& params) : SteeredObj
       .add("targetLumi"s, target_lumi_)
       .add("symmetrise"s, symmetrise_)
       .add("numThreads"s, num_threads_)
-      .add("numPoints"s, num_points_);
+      .add("numPoints"s, num_points_)
+      .add("gridCache"s, grid_cache_)
+      .add("exportBufferSize"s, export_buffer_size_)
+      .add("exportBackpressure"s, export_backpressure_)
+      .add("deferModification"s, defer_modification_)
+      .add("modificationAttempts"s, modification_attempts_);
+}
+
+size_t RunParameters::Generation::exportBufferSize() const {
+  if (export_buffer_size_ < 0)
+    throw CG_FATAL("RunParameters:Generation") << "Invalid events export buffer size: " << export_buffer_size_ << ".";
+  return export_buffer_size_;
 }
 
 ParametersDescription RunParameters::Generation::description() {
@@ -309,5 +325,22 @@ ParametersDescription RunParameters::Generation::description() {
   desc.add("symmetrise"s, false).setDescription("Are events to be symmetric wrt beam collinear axis");
   desc.add("numThreads"s, 1).setDescription("Number of threads to use for event generation");
   desc.add("numPoints"s, 100);
+  desc.add("gridCache"s, ""s)
+      .setDescription("Directory where the integration/generation grids are cached across runs (empty to disable)");
+  desc.add("exportBufferSize"s, 0)
+      .setDescription(
+          "Number of events buffered for their export in background threads (0 to export synchronously). Events "
+          "rejected by an exporter in the background are only counted (and reported at the end of the run), and are "
+          "not replaced by newly generated events as in the synchronous mode");
+  desc.add("exportBackpressure"s, "block"s)
+      .allow("block", "wait for the slowest exporter to release a buffer slot")
+      .allow("drop", "discard the event from the export (it is still counted as generated)")
+      .setDescription("Policy to follow when the events export buffer is full");
+  desc.add("deferModification"s, false)
+      .setDescription(
+          "Only run the event modification algorithms (e.g. hadronisation) on events accepted by the "
+          "unweighting, after all kinematic cuts are applied (grid-optimised generator worker only)");
+  desc.add("modificationAttempts"s, 10)
+      .setDescription("Maximal number of deferred modification attempts for an accepted event vetoed by an algorithm");
   return desc;
 }
@@ -18,6 +18,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
 
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Event/Event.h"
@@ -34,8 +37,7 @@ Event::Event(bool compressed) : compressed_(compressed) {}
 Event::Event(const Event& oth) { *this = oth; }
 
 Event& Event::operator=(const Event& oth) {
-  clear();
-  particles_ = oth.particles_;
+  particles_ = oth.particles_;  // reuses the particles buffers already allocated
   event_content_ = oth.event_content_;
   compressed_ = oth.compressed_;
   metadata = oth.metadata;
@@ -183,13 +185,13 @@ ParticlesIds Event::ids(Particle::Role role) const {
 }
 
 Particle& Event::oneWithRole(Particle::Role role) {
-  const auto parts_by_role = operator[](role);
+  auto& parts_by_role = particles_[role];
   if (parts_by_role.empty())
     throw CG_FATAL("Event") << "No particle retrieved with " << role << " role.";
   if (parts_by_role.size() > 1)
     throw CG_FATAL("Event") << "More than one particle with " << role << " role: " << parts_by_role.size()
                             << " particles.";
-  return parts_by_role.front().get();
+  return parts_by_role.front();
 }
 
 const Particle& Event::oneWithRole(Particle::Role role) const {
@@ -347,19 +349,23 @@ bool Event::empty() const { return particles_.empty(); }
 
 Particles Event::particles() const {
   Particles all_particles;
+  all_particles.reserve(size());
   for (const auto& [role, particles] : particles_)
     all_particles.insert(all_particles.end(), particles.begin(), particles.end());
-  std::sort(all_particles.begin(), all_particles.end());
+  if (!std::is_sorted(all_particles.begin(), all_particles.end()))
+    std::sort(all_particles.begin(), all_particles.end());
   return all_particles;
 }
 
 Particles Event::stableParticles() const {
   Particles stable_particles;
+  stable_particles.reserve(size());
   for (const auto& [role, particles] : particles_)
     std::copy_if(particles.begin(), particles.end(), std::back_inserter(stable_particles), [](const auto& particle) {
       return static_cast<short>(particle.status()) > 0;
     });
-  std::sort(stable_particles.begin(), stable_particles.end());
+  if (!std::is_sorted(stable_particles.begin(), stable_particles.end()))
+    std::sort(stable_particles.begin(), stable_particles.end());
   return stable_particles;
 }
 
@@ -392,7 +398,7 @@ Momentum Event::missingMomentum() const {
 
 void Event::checkKinematics() const {
   for (const auto& particle : particles()) {  // check the kinematics through parentage
-    const auto children = particle.children();
+    const auto& children = particle.children();
     if (children.empty())
       continue;
     Momentum total_momentum;
@@ -423,7 +429,7 @@ namespace cepgen {
     std::ostringstream os;
     Momentum p_total;
     for (const auto& particle : event.particles()) {
-      const ParticlesIds mothers = particle.mothers();
+      const auto& mothers = particle.mothers();
       {
         std::ostringstream oss_pdg;
         if (particle.pdgId() == PDG::invalid && !mothers.empty()) {  // particles compound
@@ -464,7 +470,8 @@ namespace cepgen {
       }
       const auto& momentum = particle.momentum();
       os << utils::format("%6s % 9.6e % 9.6e % 9.6e % 9.6e % 12.5f",
-                          (!mothers.empty() ? utils::repr(mothers, "+"s) : ""s).data(),
+                          (!mothers.empty() ? utils::repr(std::vector<int>(mothers.begin(), mothers.end()), "+"s) : ""s)
+                              .data(),
                           momentum.px(),
                           momentum.py(),
                           momentum.pz(),
@@ -491,9 +498,99 @@ namespace cepgen {
   }
 }  // namespace cepgen
 
-Event::EventMetadata::EventMetadata()
-    : std::unordered_map<std::string, float>{{"time:generation"s, -1.f},
-                                             {"time:total"s, -1.f},
-                                             {"weight"s, 1.f},
-                                             {"alphaEM"s, constants::ALPHA_EM},
-                                             {"alphaS"s, constants::ALPHA_QCD}} {}
+namespace {
+  /// Global registry of interned event metadata keys
+  class EventMetadataKeys {
+  public:
+    static EventMetadataKeys& get() {
+      static EventMetadataKeys registry;
+      return registry;
+    }
+    Event::EventMetadata::Key key(const std::string& name) {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      if (auto it = keys_.find(name); it != keys_.end())
+        return it->second;
+      names_.emplace_back(name);
+      return keys_.emplace(name, names_.size() - 1).first->second;
+    }
+    bool find(const std::string& name, Event::EventMetadata::Key& key) const {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      if (auto it = keys_.find(name); it != keys_.end()) {
+        key = it->second;
+        return true;
+      }
+      return false;
+    }
+    const std::string& name(Event::EventMetadata::Key key) const {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      if (key >= names_.size())
+        throw CG_FATAL("Event:EventMetadata") << "Invalid metadata key: " << key << ".";
+      return names_.at(key);
+    }
+
+  private:
+    EventMetadataKeys() {  // register the generator-filled keys in their enumeration order
+      for (const auto& name : {"time:generation"s, "time:total"s, "weight"s, "alphaEM"s, "alphaS"s})
+        key(name);
+    }
+    std::deque<std::string> names_;  // deque to keep the references to names valid upon registration
+    std::unordered_map<std::string, Event::EventMetadata::Key> keys_;
+    mutable std::mutex mutex_;
+  };
+}  // namespace
+
+Event::EventMetadata::EventMetadata() {
+  (*this)[GenerationTime] = -1.f;
+  (*this)[TotalTime] = -1.f;
+  (*this)[Weight] = 1.f;
+  (*this)[AlphaEM] = constants::ALPHA_EM;
+  (*this)[AlphaS] = constants::ALPHA_QCD;
+}
+
+Event::EventMetadata::Key Event::EventMetadata::key(const std::string& name) {
+  return EventMetadataKeys::get().key(name);
+}
+
+const std::string& Event::EventMetadata::name(Key key) { return EventMetadataKeys::get().name(key); }
+
+bool Event::EventMetadata::operator==(const EventMetadata& oth) const {
+  for (Key key = 0; key < std::max(filled_.size(), oth.filled_.size()); ++key) {
+    const bool filled = key < filled_.size() && filled_[key], oth_filled = key < oth.filled_.size() && oth.filled_[key];
+    if (filled != oth_filled || (filled && values_[key] != oth.values_[key]))
+      return false;
+  }
+  return true;
+}
+
+float& Event::EventMetadata::operator[](Key key) {
+  if (key >= values_.size())
+    values_.resize(key + 1, -1.f), filled_.resize(key + 1, false);
+  filled_[key] = true;
+  return values_[key];
+}
+
+float Event::EventMetadata::operator()(Key key) const {
+  return key < filled_.size() && filled_[key] ? values_[key] : -1.f;
+}
+
+float Event::EventMetadata::operator()(const std::string& name) const {
+  if (Key key; EventMetadataKeys::get().find(name, key))
+    return operator()(key);
+  return -1.f;
+}
+
+size_t Event::EventMetadata::count(const std::string& name) const {
+  if (Key key; EventMetadataKeys::get().find(name, key))
+    return key < filled_.size() && filled_[key] ? 1 : 0;
+  return 0;
+}
+
+void Event::EventMetadata::clear() { std::fill(filled_.begin(), filled_.end(), false); }
+
+std::vector<std::string> Event::EventMetadata::keys() const {
+  std::vector<std::string> keys;
+  for (Key key = 0; key < filled_.size(); ++key)
+    if (filled_[key])
+      keys.emplace_back(name(key));
+  return keys;
+}
@@ -16,9 +16,11 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 
+#include "CepGen/Core/Exception.h"
 #include "CepGen/Event/Particle.h"
 #include "CepGen/Physics/PDG.h"
 #include "CepGen/Utils/Collections.h"
@@ -52,8 +54,7 @@ Particle& Particle::addMother(Particle& mother_particle) {
     CG_DEBUG_LOOP("Particle:addMother") << "Particle (id=" << *it << ", role=" << mother_particle.role_
                                         << ", pdgId=" << mother_particle.pdg_id_ << ") is a new mother of (id=" << id_
                                         << ", role=" << role_ << ", pdgId=" << pdg_id_ << ").";
-    if (mother_particle.children_.empty() ||
-        !utils::contains(mother_particle.children_, id_))  // not yet in particle's children
+    if (mother_particle.children_.count(id_) == 0)  // not yet in particle's children
       mother_particle.addChild(*this);
     else if (mother_particle.status_ > 0)
       mother_particle.status_ = static_cast<int>(Status::Propagator);
@@ -66,8 +67,7 @@ Particle& Particle::addChild(Particle& child_particle) {
     CG_DEBUG_LOOP("Particle:addChild") << "Particle (id=" << *it << ", role=" << child_particle.role_
                                        << ", pdgId=" << child_particle.pdg_id_ << ") is a new child of (id=" << id_
                                        << ", role=" << role_ << ", pdgId=" << pdg_id_ << ").";
-    if (child_particle.mothers_.empty() ||
-        !utils::contains(child_particle.mothers_, id_))  // not yet in particle's mothers
+    if (child_particle.mothers_.count(id_) == 0)  // not yet in particle's mothers
       child_particle.addMother(*this);
     if (status_ > 0)
       status_ = static_cast<int>(Status::Propagator);
@@ -199,14 +199,154 @@ namespace cepgen {
   }
 }  // namespace cepgen
 
-ParticlesMap::ParticlesMap(const ParticlesMap& other)
-    : std::unordered_map<Particle::Role, Particles, utils::EnumHash<Particle::Role> >() {
-  *this = other;
+ParticlesIds::ParticlesIds(std::initializer_list<int> ids) {
+  for (const auto& id : ids)
+    insert(id);
 }
 
+bool ParticlesIds::operator==(const ParticlesIds& oth) const {
+  return std::equal(begin(), end(), oth.begin(), oth.end());
+}
+
+std::pair<ParticlesIds::iterator, bool> ParticlesIds::insert(int id) {
+  if (overflow_.empty()) {
+    auto *beg = inline_.data(), *end = beg + num_inline_;
+    auto* it = std::lower_bound(beg, end, id);
+    if (it != end && *it == id)
+      return {it, false};
+    if (num_inline_ < INLINE_SIZE) {  // still room in the inline storage
+      std::move_backward(it, end, end + 1);
+      *it = id;
+      ++num_inline_;
+      return {it, true};
+    }
+    overflow_.assign(beg, end);  // inline storage is full; move everything to the heap
+    num_inline_ = 0;
+  }
+  auto it = std::lower_bound(overflow_.begin(), overflow_.end(), id);
+  if (it != overflow_.end() && *it == id)
+    return {&*it, false};
+  it = overflow_.insert(it, id);
+  return {&*it, true};
+}
+
+size_t ParticlesIds::erase(int id) {
+  if (!overflow_.empty()) {
+    if (auto it = std::lower_bound(overflow_.begin(), overflow_.end(), id); it != overflow_.end() && *it == id) {
+      overflow_.erase(it);
+      return 1;
+    }
+    return 0;
+  }
+  auto *beg = inline_.data(), *end = beg + num_inline_;
+  if (auto* it = std::lower_bound(beg, end, id); it != end && *it == id) {
+    std::move(it + 1, end, it);
+    --num_inline_;
+    return 1;
+  }
+  return 0;
+}
+
+void ParticlesIds::clear() {
+  num_inline_ = 0;
+  overflow_.clear();
+}
+
+ParticlesIds::iterator ParticlesIds::find(int id) const {
+  if (auto it = std::lower_bound(begin(), end(), id); it != end() && *it == id)
+    return it;
+  return end();
+}
+
+ParticlesMap::ParticlesMap()
+    : particles_{{value_type{Particle::Role::UnknownRole, {}},
+                  value_type{Particle::Role::IncomingBeam1, {}},
+                  value_type{Particle::Role::IncomingBeam2, {}},
+                  value_type{Particle::Role::OutgoingBeam1, {}},
+                  value_type{Particle::Role::Intermediate, {}},
+                  value_type{Particle::Role::OutgoingBeam2, {}},
+                  value_type{Particle::Role::CentralSystem, {}},
+                  value_type{Particle::Role::Parton1, {}},
+                  value_type{Particle::Role::Parton2, {}}}} {}
+
+ParticlesMap::ParticlesMap(const ParticlesMap& other) : ParticlesMap() { *this = other; }
+
 ParticlesMap& ParticlesMap::operator=(const ParticlesMap& other) {
-  for (const auto& [role, particles] : other)
-    for (const auto& particle : particles)
-      (*this)[role].emplace_back(Particle(particle));
+  for (size_t i = 0; i < NUM_ROLES; ++i) {  // copy-assignment reuses the already allocated particles buffers
+    if (other.filled_[i])
+      particles_[i].second = other.particles_[i].second;
+    else
+      particles_[i].second.clear();
+  }
+  filled_ = other.filled_;
   return *this;
 }
+
+bool ParticlesMap::operator==(const ParticlesMap& other) const {
+  if (filled_ != other.filled_)
+    return false;
+  for (size_t i = 0; i < NUM_ROLES; ++i)
+    if (filled_[i] && particles_[i].second != other.particles_[i].second)
+      return false;
+  return true;
+}
+
+Particles& ParticlesMap::operator[](Particle::Role role) {
+  const auto idx = index(role);
+  filled_[idx] = true;
+  return particles_[idx].second;
+}
+
+Particles& ParticlesMap::at(Particle::Role role) {
+  if (const auto idx = index(role); filled_[idx])
+    return particles_[idx].second;
+  throw CG_FATAL("ParticlesMap:at") << "No particle with role " << role << " in the map.";
+}
+
+const Particles& ParticlesMap::at(Particle::Role role) const {
+  if (const auto idx = index(role); filled_[idx])
+    return particles_[idx].second;
+  throw CG_FATAL("ParticlesMap:at") << "No particle with role " << role << " in the map.";
+}
+
+size_t ParticlesMap::count(Particle::Role role) const { return filled_[index(role)] ? 1 : 0; }
+
+size_t ParticlesMap::erase(Particle::Role role) {
+  const auto idx = index(role);
+  if (!filled_[idx])
+    return 0;
+  particles_[idx].second.clear();
+  filled_[idx] = false;
+  return 1;
+}
+
+void ParticlesMap::clear() {
+  for (size_t i = 0; i < NUM_ROLES; ++i)
+    particles_[i].second.clear(), filled_[i] = false;
+}
+
+size_t ParticlesMap::size() const { return std::count(filled_.begin(), filled_.end(), true); }
+
+size_t ParticlesMap::index(Particle::Role role) {
+  switch (role) {
+    case Particle::Role::UnknownRole:
+      return 0;
+    case Particle::Role::IncomingBeam1:
+      return 1;
+    case Particle::Role::IncomingBeam2:
+      return 2;
+    case Particle::Role::OutgoingBeam1:
+      return 3;
+    case Particle::Role::Intermediate:
+      return 4;
+    case Particle::Role::OutgoingBeam2:
+      return 5;
+    case Particle::Role::CentralSystem:
+      return 6;
+    case Particle::Role::Parton1:
+      return 7;
+    case Particle::Role::Parton2:
+      return 8;
+  }
+  throw CG_FATAL("ParticlesMap:index") << "Invalid particle role: " << static_cast<int>(role) << ".";
+}
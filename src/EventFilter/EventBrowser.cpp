@@ -33,89 +33,154 @@ const std::regex EventBrowser::rgx_select_role2_("([a-zA-Z0-9]+)\\(([a-z]+[0-9]?
                                                  std::regex_constants::extended);
 
 double EventBrowser::get(const Event& event, const std::string& variable_name) const {
+  return compile(variable_name)(event);
+}
+
+EventBrowser::Accessor EventBrowser::compile(const std::string& variable_name) const {
+  Accessor accessor(variable_name);
   std::smatch sm;
-  if (std::regex_match(variable_name, sm, rgx_select_id_))  // particle-level variables (indexed by integer id)
-    return variable(event, event(std::stoul(sm[2].str())), sm[1].str());
-  if (std::regex_match(variable_name, sm, rgx_select_id2_))  // particle-level variables (indexed by integer id)
-    return variable(event, event(std::stoul(sm[2].str())), event(std::stoul(sm[3].str())), sm[1].str());
-  const auto check_role = [&](const std::string& role, const std::string& variable) -> bool {
-    if (role_str_.count(role) > 0)
-      return true;
-    CG_WARNING("EventBrowser") << "Invalid particle role retrieved from configuration: \"" << role << "\".\n\t"
-                               << "Skipping the variable \"" << variable << "\" in the output module.";
-    return false;
+  const auto single_particle = [&](const std::string& variable) {
+    if (m_mom_str_.count(variable))
+      accessor.quantity_ = Accessor::Quantity::momentum, accessor.momentum_method_ = m_mom_str_.at(variable);
+    else if (variable == "xi")
+      accessor.quantity_ = Accessor::Quantity::xi;
+    else if (variable == "pdg")
+      accessor.quantity_ = Accessor::Quantity::pdg;
+    else if (variable == "charge")
+      accessor.quantity_ = Accessor::Quantity::charge;
+    else if (variable == "status")
+      accessor.quantity_ = Accessor::Quantity::status;
+    else
+      throw CG_ERROR("EventBrowser") << "Failed to retrieve variable \"" << variable << "\".";
   };
-  if (std::regex_match(variable_name, sm, rgx_select_role_)) {  // particle-level variables (indexed by role)
-    if (const auto& str_role = sm[2].str(); check_role(str_role, variable_name))
-      return variable(event, event(role_str_.at(str_role))[0], sm[1].str());
-    return INVALID_OUTPUT;
-  }
-  if (std::regex_match(variable_name, sm, rgx_select_role2_)) {  // particle-level variables (indexed by role)
-    if (const auto &str_role1 = sm[2].str(), &str_role2 = sm[3].str();
-        check_role(str_role1, variable_name) && check_role(str_role2, variable_name))
-      return variable(event, event(role_str_.at(str_role1))[0], event(role_str_.at(str_role2))[0], sm[1].str());
-    return INVALID_OUTPUT;
-  }
-  return variable(event, variable_name);  // event-level variables
+  const auto two_particles = [&](const std::string& variable) {
+    if (m_two_mom_str_.count(variable))
+      accessor.quantity_ = Accessor::Quantity::twoMomenta, accessor.two_momenta_method_ = m_two_mom_str_.at(variable);
+    else if (m_mom_str_.count(variable))
+      accessor.quantity_ = Accessor::Quantity::momentaSum, accessor.momentum_method_ = m_mom_str_.at(variable);
+    else if (variable == "acop"s)  // two-particle acoplanarity
+      accessor.quantity_ = Accessor::Quantity::acoplanarity;
+    else
+      throw CG_ERROR("EventBrowser") << "Failed to retrieve variable \"" << variable << "\".";
+  };
+  if (std::regex_match(variable_name, sm, rgx_select_id_)) {  // particle-level variables (indexed by integer id)
+    accessor.particle1_.id = std::stoul(sm[2].str());
+    single_particle(sm[1].str());
+  } else if (std::regex_match(variable_name, sm, rgx_select_id2_)) {  // two-particle variables (indexed by integer ids)
+    accessor.particle1_.id = std::stoul(sm[2].str());
+    accessor.particle2_.id = std::stoul(sm[3].str());
+    two_particles(sm[1].str());
+  } else if (std::regex_match(variable_name, sm, rgx_select_role_)) {  // particle-level variables (indexed by role)
+    if (accessor.particle1_ = selector(sm[2].str(), variable_name); accessor.particle1_.by_role)
+      single_particle(sm[1].str());
+  } else if (std::regex_match(variable_name, sm, rgx_select_role2_)) {  // two-particle variables (indexed by roles)
+    accessor.particle1_ = selector(sm[2].str(), variable_name);
+    accessor.particle2_ = selector(sm[3].str(), variable_name);
+    if (accessor.particle1_.by_role && accessor.particle2_.by_role)
+      two_particles(sm[1].str());
+  } else if (variable_name == "np")  // number of particles in event (whatever the status)
+    accessor.quantity_ = Accessor::Quantity::numParticles;
+  else if (variable_name == "nob1")  // number of (stable) particles in outgoing diffractive system
+    accessor.quantity_ = Accessor::Quantity::numStableOutgoingBeam1;
+  else if (variable_name == "nob2")
+    accessor.quantity_ = Accessor::Quantity::numStableOutgoingBeam2;
+  else if (variable_name == "met")  // missing transverse energy
+    accessor.quantity_ = Accessor::Quantity::missingEnergy;
+  else if (variable_name == "mephi"s)  // azimuthal component of the missing transverse energy
+    accessor.quantity_ = Accessor::Quantity::missingEnergyPhi;
+  else if (variable_name == "cmEnergy")  // two-beam centre-of-mass energy
+    accessor.quantity_ = Accessor::Quantity::cmEnergy;
+  else if (startsWith(variable_name, "meta:")) {  // metadata field
+    accessor.quantity_ = Accessor::Quantity::metadata;
+    accessor.metadata_key_ = Event::EventMetadata::key(variable_name.substr(5));
+  } else
+    throw CG_ERROR("EventBrowser") << "Failed to retrieve the event-level variable \"" << variable_name << "\".";
+  return accessor;
 }
 
-double EventBrowser::variable(const Event& event, const Particle& particle, const std::string& variable_name) const {
-  if (m_mom_str_.count(variable_name)) {
-    const auto& meth = m_mom_str_.at(variable_name);
-    return (particle.momentum().*meth)();
-  }
-  if (variable_name == "xi") {
-    if (const auto& moth = particle.mothers(); !moth.empty())
-      return 1. - particle.momentum().energy() / event(*moth.begin()).momentum().energy();
-    CG_WARNING("EventBrowser") << "Failed to retrieve parent particle to compute xi "
-                               << "for the following particle:\n"
-                               << particle;
-    return INVALID_OUTPUT;
-  }
-  if (variable_name == "pdg")
-    return static_cast<double>(particle.integerPdgId());
-  if (variable_name == "charge")
-    return particle.charge();
-  if (variable_name == "status")
-    return static_cast<double>(particle.status());
-  throw CG_ERROR("EventBrowser") << "Failed to retrieve variable \"" << variable_name << "\".";
+std::vector<EventBrowser::Accessor> EventBrowser::compile(const std::vector<std::string>& variables_names) const {
+  std::vector<Accessor> accessors;
+  accessors.reserve(variables_names.size());
+  for (const auto& variable_name : variables_names)
+    accessors.emplace_back(compile(variable_name));
+  return accessors;
 }
 
-double EventBrowser::variable(const Event&,
-                              const Particle& particle1,
-                              const Particle& particle2,
-                              const std::string& variable_name) const {
-  if (m_two_mom_str_.count(variable_name)) {
-    const auto& meth = m_two_mom_str_.at(variable_name);
-    return (particle1.momentum().*meth)(particle2.momentum());
-  }
-  if (m_mom_str_.count(variable_name)) {
-    const auto& meth = m_mom_str_.at(variable_name);
-    return ((particle1.momentum() + particle2.momentum()).*meth)();
-  }
-  if (variable_name == "acop"s)  // two-particle acoplanarity
-    return 1. - fabs(particle1.momentum().deltaPhi(particle2.momentum()) * M_1_PI);
-  throw CG_ERROR("EventBrowser") << "Failed to retrieve variable \"" << variable_name << "\".";
+void EventBrowser::get(const Event& event, const std::vector<Accessor>& accessors, std::vector<double>& values) {
+  values.resize(accessors.size());
+  for (size_t i = 0; i < accessors.size(); ++i)
+    values[i] = accessors[i](event);
+}
+
+void EventBrowser::get(const std::vector<Event>& events,
+                       const std::vector<Accessor>& accessors,
+                       std::vector<double>& values) {
+  values.resize(events.size() * accessors.size());
+  auto value = values.begin();
+  for (const auto& event : events)
+    for (const auto& accessor : accessors)
+      *value++ = accessor(event);
+}
+
+EventBrowser::Accessor::Selector EventBrowser::selector(const std::string& role, const std::string& variable) const {
+  Accessor::Selector selector;
+  if (role_str_.count(role) > 0)
+    selector.by_role = true, selector.role = role_str_.at(role);
+  else
+    CG_WARNING("EventBrowser") << "Invalid particle role retrieved from configuration: \"" << role << "\".\n\t"
+                               << "Skipping the variable \"" << variable << "\" in the output module.";
+  return selector;
+}
+
+const cepgen::Particle& EventBrowser::Accessor::Selector::operator()(const Event& event) const {
+  return by_role ? event(role)[0] : event(id);
 }
 
-double EventBrowser::variable(const Event& event, const std::string& variable_name) {
-  if (variable_name == "np")  // number of particles in event (whatever the status)
-    return static_cast<double>(event.size());
-  if (variable_name == "nob1" ||
-      variable_name == "nob2") {  // number of (stable) particles in outgoing diffractive system
-    const auto& beam_particles =
-        event(variable_name == "nob1" ? Particle::Role::OutgoingBeam1 : Particle::Role::OutgoingBeam2);
-    return static_cast<double>(std::count_if(beam_particles.begin(), beam_particles.end(), [](const auto& particle) {
-      return static_cast<int>(particle.status()) > 0;
-    }));
+double EventBrowser::Accessor::operator()(const Event& event) const {
+  switch (quantity_) {
+    case Quantity::invalid:
+      return INVALID_OUTPUT;
+    case Quantity::momentum:
+      return (particle1_(event).momentum().*momentum_method_)();
+    case Quantity::xi: {
+      const auto& particle = particle1_(event);
+      if (const auto& moth = particle.mothers(); !moth.empty())
+        return 1. - particle.momentum().energy() / event(*moth.begin()).momentum().energy();
+      CG_WARNING("EventBrowser") << "Failed to retrieve parent particle to compute xi "
+                                 << "for the following particle:\n"
+                                 << particle;
+      return INVALID_OUTPUT;
+    }
+    case Quantity::pdg:
+      return static_cast<double>(particle1_(event).integerPdgId());
+    case Quantity::charge:
+      return particle1_(event).charge();
+    case Quantity::status:
+      return static_cast<double>(particle1_(event).status());
+    case Quantity::twoMomenta:
+      return (particle1_(event).momentum().*two_momenta_method_)(particle2_(event).momentum());
+    case Quantity::momentaSum:
+      return ((particle1_(event).momentum() + particle2_(event).momentum()).*momentum_method_)();
+    case Quantity::acoplanarity:
+      return 1. - std::fabs(particle1_(event).momentum().deltaPhi(particle2_(event).momentum()) * M_1_PI);
+    case Quantity::numParticles:
+      return static_cast<double>(event.size());
+    case Quantity::numStableOutgoingBeam1:
+    case Quantity::numStableOutgoingBeam2: {
+      const auto& beam_particles = event(quantity_ == Quantity::numStableOutgoingBeam1 ? Particle::Role::OutgoingBeam1
+                                                                                       : Particle::Role::OutgoingBeam2);
+      return static_cast<double>(std::count_if(beam_particles.begin(), beam_particles.end(), [](const auto& particle) {
+        return static_cast<int>(particle.status()) > 0;
+      }));
+    }
+    case Quantity::missingEnergy:
+      return event.missingMomentum().pt();
+    case Quantity::missingEnergyPhi:
+      return event.missingMomentum().phi();
+    case Quantity::cmEnergy:
+      return event.cmEnergy();
+    case Quantity::metadata:
+      return event.metadata(metadata_key_);
   }
-  if (variable_name == "met")  // missing transverse energy
-    return event.missingMomentum().pt();
-  if (variable_name == "mephi"s)  // azimuthal component of the missing transverse energy
-    return event.missingMomentum().phi();
-  if (variable_name == "cmEnergy")  // two-beam centre-of-mass energy
-    return event.cmEnergy();
-  if (startsWith(variable_name, "meta:"))  // metadata field
-    return event.metadata(variable_name.substr(5));
-  throw CG_ERROR("EventBrowser") << "Failed to retrieve the event-level variable \"" << variable_name << "\".";
+  return INVALID_OUTPUT;
 }
@@ -0,0 +1,126 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <utility>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/EventFilter/EventExportPipeline.h"
+#include "CepGen/EventFilter/EventExporter.h"
+
+using namespace cepgen;
+
+EventExportPipeline::EventExportPipeline(const std::vector<EventExporter*>& exporters,
+                                         size_t capacity,
+                                         Backpressure backpressure)
+    : backpressure_(backpressure), slots_(capacity) {
+  if (capacity == 0)
+    throw CG_FATAL("EventExportPipeline") << "Events buffer capacity must be strictly positive.";
+  for (auto* exporter : exporters) {
+    if (!exporter)
+      throw CG_FATAL("EventExportPipeline") << "Invalid events exporter.";
+    auto& consumer = consumers_.emplace_back(std::make_unique<Consumer>());
+    consumer->exporter = exporter;
+  }
+  for (auto& consumer : consumers_)
+    consumer->thread = std::thread(&EventExportPipeline::consume, this, std::ref(*consumer));
+  CG_DEBUG("EventExportPipeline") << "Asynchronous events export pipeline started with a " << capacity
+                                  << "-event buffer for " << consumers_.size() << " exporter(s).";
+}
+
+EventExportPipeline::~EventExportPipeline() {
+  try {
+    flush();
+  } catch (const std::exception& exc) {
+    CG_WARNING("EventExportPipeline") << "Exception raised while exporting events: " << exc.what();
+  }
+  stop_.store(true);
+  notify(event_queued_);
+  for (auto& consumer : consumers_)
+    if (consumer->thread.joinable())
+      consumer->thread.join();
+  if (num_dropped_ > 0 || num_failed_ > 0)
+    CG_WARNING("EventExportPipeline") << num_dropped_ << " event(s) dropped due to a full export buffer, "
+                                      << num_failed_ << " event export(s) failed.";
+}
+
+bool EventExportPipeline::push(const Event& event) {
+  const auto head = head_.load(std::memory_order_relaxed);
+  if (head - minimumTail() >= slots_.size()) {  // buffer is full
+    if (backpressure_ == Backpressure::drop) {
+      ++num_dropped_;
+      return false;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    slot_released_.wait(lock, [this, &head] { return head - minimumTail() < slots_.size(); });
+  }
+  slots_[head % slots_.size()] = event;  // slot buffers are reused from one event to the other
+  head_.store(head + 1, std::memory_order_release);
+  notify(event_queued_);
+  return true;
+}
+
+void EventExportPipeline::flush() {
+  const auto head = head_.load(std::memory_order_relaxed);
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    slot_released_.wait(lock, [this, &head] { return minimumTail() >= head; });
+  }
+  std::lock_guard<std::mutex> lock(exception_mutex_);
+  if (exception_)
+    std::rethrow_exception(std::exchange(exception_, nullptr));
+}
+
+void EventExportPipeline::consume(Consumer& consumer) {
+  bool failed = false;  // once an exporter has thrown, its events are skipped to release the buffer
+  while (true) {
+    const auto tail = consumer.tail.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire)) {  // nothing to export; sleep until an event is queued
+      std::unique_lock<std::mutex> lock(mutex_);
+      event_queued_.wait(lock, [this, &tail] { return tail != head_.load(std::memory_order_acquire) || stop_.load(); });
+      if (tail == head_.load(std::memory_order_acquire))  // stopped, with all events exported
+        break;
+      continue;
+    }
+    if (!failed) {
+      try {
+        if (!(*consumer.exporter << slots_[tail % slots_.size()]))
+          ++num_failed_;
+      } catch (...) {
+        failed = true;
+        std::lock_guard<std::mutex> lock(exception_mutex_);
+        if (!exception_)
+          exception_ = std::current_exception();
+      }
+    }
+    consumer.tail.store(tail + 1, std::memory_order_release);
+    notify(slot_released_);
+  }
+}
+
+void EventExportPipeline::notify(std::condition_variable& condition) {
+  { std::lock_guard<std::mutex> lock(mutex_); }  // a waiting thread is either asleep, or yet to check its condition
+  condition.notify_all();
+}
+
+size_t EventExportPipeline::minimumTail() const {
+  auto tail = head_.load(std::memory_order_relaxed);
+  for (const auto& consumer : consumers_)
+    tail = std::min(tail, consumer->tail.load(std::memory_order_acquire));
+  return tail;
+}
@@ -16,6 +16,11 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Core/RunParameters.h"
 #include "CepGen/EventFilter/EventBrowser.h"
@@ -48,19 +53,20 @@ public:
         auto hist = utils::Hist1D(hvar.set("name", name));
         hist.xAxis().setLabel(vars.at(0));
         hist.yAxis().setLabel("d$\\sigma$/d" + vars.at(0) + " (pb/bin)");
-        hists1d_.emplace_back(Hist1DInfo{vars.at(0), hist, log});
+        hists1d_.emplace_back(Hist1DInfo{browser_.compile(vars.at(0)), hist, log});
       } else if (vars.size() == 2) {  // 2D histogram
         auto hist = utils::Hist2D(hvar.set("name", utils::sanitise(name)));
         hist.xAxis().setLabel(vars.at(0));
         hist.yAxis().setLabel(vars.at(1));
         hist.zAxis().setLabel("d${}^2\\sigma$/d" + vars.at(0) + "/d" + vars.at(1) + " (pb/bin)");
-        hists2d_.emplace_back(Hist2DInfo{vars.at(0), vars.at(1), hist, log});
+        hists2d_.emplace_back(Hist2DInfo{browser_.compile(vars.at(0)), browser_.compile(vars.at(1)), hist, log});
       } else
         throw CG_FATAL("EventHarvester") << "Invalid number of variables to correlate for '" << key << "'.";
     }
   }
   ~EventHarvester() override {
     try {  // histogram printout
+      mergeAccumulators();
       for (auto& info : hists1d_) {
         info.histogram.scale(cross_section_ / num_events_);
         info.histogram.setTitle(proc_name_);
@@ -91,42 +97,94 @@ public:
 
   void setCrossSection(const Value& cross_section) override { cross_section_ = cross_section; }
   bool operator<<(const Event& event) override {
-    // increment the corresponding histograms
-    for (auto& info : hists1d_)
-      info.histogram.fill(browser_.get(event, info.variable));
-    for (auto& info : hists2d_)
-      info.histogram.fill(browser_.get(event, info.variable1), browser_.get(event, info.variable2));
-    ++num_events_;
+    // increment the histograms of the calling thread
+    auto& accumulator = threadAccumulator();
+    for (size_t i = 0; i < hists1d_.size(); ++i)
+      accumulator.hists1d[i].fill(hists1d_[i].variable(event));
+    for (size_t i = 0; i < hists2d_.size(); ++i)
+      accumulator.hists2d[i].fill(hists2d_[i].variable1(event), hists2d_[i].variable2(event));
+    ++accumulator.num_events;
     return true;
   }
 
 private:
+  /// Histograms filled by one producer thread, merged into the final histograms at the end of the run
+  struct Accumulator {
+    std::vector<utils::Hist1D> hists1d;
+    std::vector<utils::Hist2D> hists2d;
+    unsigned long num_events{0ul};
+  };
+  /// Histograms set of the calling thread, booked at its first call
+  /// \note A per-thread cache keyed by the unique harvester identifier avoids any locking once the set is booked.
+  ///  It only holds weak handles to the sets, owned by the harvester, and released along with it.
+  Accumulator& threadAccumulator() {
+    thread_local std::unordered_map<unsigned long long, std::weak_ptr<Accumulator> > thread_accumulators;
+    if (auto it = thread_accumulators.find(instance_id_); it != thread_accumulators.end())
+      if (auto accumulator = it->second.lock())
+        return *accumulator;
+    for (auto it = thread_accumulators.begin(); it != thread_accumulators.end();)  // drop the released harvesters sets
+      it = it->second.expired() ? thread_accumulators.erase(it) : std::next(it);
+    std::lock_guard<std::mutex> lock(accumulators_mutex_);
+    auto accumulator = std::make_shared<Accumulator>();
+    for (const auto& info : hists1d_)
+      accumulator->hists1d.emplace_back(info.histogram);
+    for (const auto& info : hists2d_)
+      accumulator->hists2d.emplace_back(info.histogram);
+    thread_accumulators[instance_id_] = accumulator;
+    return *accumulators_.emplace_back(std::move(accumulator));
+  }
+  /// Exact merging of all threads histograms into the final histograms
+  void mergeAccumulators() {
+    std::lock_guard<std::mutex> lock(accumulators_mutex_);
+    for (const auto& accumulator : accumulators_) {
+      for (size_t i = 0; i < hists1d_.size(); ++i)
+        hists1d_[i].histogram.merge(accumulator->hists1d[i]);
+      for (size_t i = 0; i < hists2d_.size(); ++i)
+        hists2d_[i].histogram.merge(accumulator->hists2d[i]);
+      num_events_ += accumulator->num_events;
+    }
+  }
+
   void initialise() override {
     num_events_ = 0ul;
+    {  // threads histograms sets are kept booked, as referenced by the per-thread caches
+      std::lock_guard<std::mutex> lock(accumulators_mutex_);
+      for (auto& accumulator : accumulators_) {
+        for (auto& hist : accumulator->hists1d)
+          hist.clear();
+        for (auto& hist : accumulator->hists2d)
+          hist.clear();
+        accumulator->num_events = 0ul;
+      }
+    }
     proc_name_ = ProcessFactory::get().describe(runParameters().processName());
     proc_name_ +=
         ", $\\sqrt{s} =$ " + utils::format("%g TeV", runParameters().kinematics().incomingBeams().sqrtS() * 1.e-3);
   }
 
-  const utils::EventBrowser browser_;      ///< Event string-to-quantity extraction tool
-  std::unique_ptr<utils::Drawer> drawer_;  ///< Drawing utility
+  static inline std::atomic<unsigned long long> num_instances_{0ull};  ///< Number of harvesters built
+  const unsigned long long instance_id_{++num_instances_};             ///< Unique identifier, for per-thread caches
+  const utils::EventBrowser browser_;                                  ///< Event string-to-quantity extraction tool
+  std::unique_ptr<utils::Drawer> drawer_;                              ///< Drawing utility
 
   Value cross_section_{1., 0.};    ///< Cross-section value, in pb
   unsigned long num_events_{0ul};  ///< Number of events processed
   std::string proc_name_;          ///< Name of the physics process
   struct Hist1DInfo {
-    std::string variable;
+    utils::EventBrowser::Accessor variable;
     utils::Hist1D histogram;
     bool log_y;
   };  ///< 1D histogram definition
   std::vector<Hist1DInfo> hists1d_;  ///< List of 1D histograms
   struct Hist2DInfo {
-    std::string variable1;
-    std::string variable2;
+    utils::EventBrowser::Accessor variable1;
+    utils::EventBrowser::Accessor variable2;
     utils::Hist2D histogram;
     bool log_z;
   };  ///< 2D histogram definition
   std::vector<Hist2DInfo> hists2d_;  ///< List of 2D histograms
+  std::mutex accumulators_mutex_;
+  std::vector<std::shared_ptr<Accumulator> > accumulators_;  ///< Histograms sets booked by all producer threads
 };
 REGISTER_EXPORTER("eventHarvester", EventHarvester);
 
@@ -70,8 +70,8 @@ namespace cepgen::formfac {
     }
 
   private:
-    void eval() override {
-      const double tau_val = tau(q2_);
+    FormFactors compute(double q2) const override {
+      const double tau_val = tau(q2);
 
       double num_e = 1., den_e = 1.;
       for (size_t i = 0; i < a_e_.size(); ++i)
@@ -87,7 +87,7 @@ namespace cepgen::formfac {
         den_m += b_m_.at(i) * std::pow(tau_val, 1. + i);
       const auto gm = MU * num_m / den_m;
 
-      setGEGM(ge, gm);
+      return fromGEGM(q2, ge, gm);
     }
 
     const int mode_;
@@ -42,20 +42,20 @@ namespace cepgen::formfac {
     static ParametersDescription description();
 
   private:
-    void eval() override {
-      if (q2_ > max_q2_)
-        CG_WARNING("BrashEtAl") << "Q² = " << q2_ << " > " << max_q2_ << " GeV² = max(Q²).\n\t"
+    FormFactors compute(double q2) const override {
+      if (q2 > max_q2_)
+        CG_WARNING("BrashEtAl") << "Q² = " << q2 << " > " << max_q2_ << " GeV² = max(Q²).\n\t"
                                 << "Brash et al. FF parameterisation not designed for high-Q² values.";
-      const auto r = std::min(1., 1. - r_coefficient_.at(0) * (q2_ - r_coefficient_.at(1)));
+      const auto r = std::min(1., 1. - r_coefficient_.at(0) * (q2 - r_coefficient_.at(1)));
       if (r < 0.)
-        return;
-      const auto q = std::sqrt(q2_),
+        return FormFactors{};
+      const auto q = std::sqrt(q2),
                  gm = 1. / (1. + q * (gm_coefficient_.at(0) +
                                       q * (gm_coefficient_.at(1) +
                                            q * (gm_coefficient_.at(2) +
                                                 q * (gm_coefficient_.at(3) + q * gm_coefficient_.at(4))))));
 
-      setGEGM(r * gm, MU * gm);
+      return fromGEGM(q2, r * gm, MU * gm);
     }
     const std::vector<double> gm_coefficient_, r_coefficient_;
     const double max_q2_;
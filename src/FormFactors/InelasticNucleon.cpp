@@ -17,7 +17,9 @@
  */
 
 #include <cmath>
+#include <mutex>
 
+#include "CepGen/Core/Exception.h"
 #include "CepGen/FormFactors/Parameterisation.h"
 #include "CepGen/Integration/Integrator.h"
 #include "CepGen/Modules/FormFactorsFactory.h"
@@ -26,6 +28,10 @@
 #include "CepGen/Physics/Utils.h"
 #include "CepGen/StructureFunctions/Parameterisation.h"
 #include "CepGen/Utils/Message.h"
+#include "CepGen/Utils/TableCache.h"
+#include "CepGen/Utils/UniformGrid.h"
+
+using namespace std::string_literals;
 
 namespace cepgen::formfac {
   class InelasticNucleon : public Parameterisation {
@@ -38,19 +44,15 @@ namespace cepgen::formfac {
           mx_range_(steer<Limits>("mxRange")),
           mx2_range_{mx_range_.min() * mx_range_.min(), mx_range_.max() * mx_range_.max()},
           dm2_range_{mx2_range_.min() - mp2_, mx2_range_.max() - mp2_},
-          eval_fe_([this](double mx2) {
-            const auto xbj = utils::xBj(q2_, mp2_, mx2);
-            return sf_->F2(xbj, q2_) * xbj;
-          }),
-          eval_fm_([this](double mx2) {
-            const auto xbj = utils::xBj(q2_, mp2_, mx2);
-            return sf_->F2(xbj, q2_) / xbj;
-          }) {
+          num_q2_(steer<int>("numQ2")) {
       CG_INFO("InelasticNucleon") << "Inelastic nucleon form factors parameterisation built with:\n"
                                   << " * structure functions modelling: " << steer<ParametersList>("structureFunctions")
                                   << "\n"
                                   << " * integrator algorithm: " << steer<ParametersList>("integrator") << "\n"
                                   << " * diffractive mass range: " << steer<Limits>("mxRange") << " GeV^2.";
+      if (num_q2_ < 0 || num_q2_ == 1)
+        throw CG_FATAL("InelasticNucleon") << "Invalid number of log(Q^2) nodes in the FE/FM table: " << num_q2_
+                                           << ". At least two nodes are required (or 0 to disable the table).";
     }
 
     static ParametersDescription description() {
@@ -62,24 +64,94 @@ namespace cepgen::formfac {
           .setDescription("type of numerical integrator algorithm to use");
       desc.add("computeFM", false).setDescription("compute, or neglect the F2/xbj^3 term");
       desc.add("mxRange", Limits{1.0732 /* mp + mpi0 */, 20.}).setDescription("diffractive mass range (in GeV/c^2)");
+      desc.add("numQ2", 0).setDescription("number of log(Q^2) nodes in the FE/FM table (0 to integrate for each Q^2)");
+      desc.add("q2Range", Limits{1.e-5, 1.e4}).setDescription("virtuality range covered by the FE/FM table (in GeV^2)");
+      desc += Table::cachingDescription(10, 1.e-3);
       return desc;
     }
 
   protected:
-    void eval() override {
-      const auto inv_q2 = 1. / q2_;
-      const auto fe = integrator_->integrate(eval_fe_, mx2_range_) * inv_q2;
-      const auto fm = compute_fm_ ? integrator_->integrate(eval_fm_, mx2_range_) * inv_q2 : 0.;
-      setFEFM(fe, fm);
+    FormFactors compute(double q2) const override {
+      if (const auto* table = this->table(); table && table->contains({q2})) {
+        const auto vals = table->eval({q2});
+        return fromFEFM(q2, vals[0], vals[1]);
+      }
+      // outside the table, a full integration is performed with the (stateful) integrator and structure functions
+      const std::lock_guard<std::mutex> lock(integration_mutex_);
+      const auto vals = integrate(*sf_, *integrator_, q2);
+      return fromFEFM(q2, vals[0], vals[1]);
     }
     bool fragmenting() const override { return true; }
 
   private:
+    using Table = UniformGrid<1, 2>;
+    /// Integrate the FE and FM form factors over the diffractive mass range for a given virtuality
+    Table::values_t integrate(strfun::Parameterisation& sf, Integrator& integrator, double q2) const {
+      const auto inv_q2 = 1. / q2;
+      const auto fe = integrator.integrate(
+                          [&sf, &q2, this](double mx2) {
+                            const auto xbj = utils::xBj(q2, mp2_, mx2);
+                            return sf.F2(xbj, q2) * xbj;
+                          },
+                          mx2_range_) *
+                      inv_q2;
+      const auto fm = compute_fm_ ? integrator.integrate(
+                                        [&sf, &q2, this](double mx2) {
+                                          const auto xbj = utils::xBj(q2, mp2_, mx2);
+                                          return sf.F2(xbj, q2) / xbj;
+                                        },
+                                        mx2_range_) *
+                                        inv_q2
+                                  : 0.;
+      return {fe, fm};
+    }
+    /// FE/FM table, shared by all instances with the same configuration, and built at its first use
+    const Table* table() const {
+      if (num_q2_ == 0)
+        return nullptr;
+      std::call_once(table_retrieved_, [this]() {
+        table_ = utils::TableCache::shared<Table>("formfac", tableConfiguration(), [this]() { return buildTable(); });
+      });
+      return table_.get();
+    }
+    /// Serialised configuration of the FE/FM table
+    std::string tableConfiguration() const {
+      return ParametersList()
+          .set("pdgId", steer<int>("pdgId"))
+          .set("structureFunctions", sf_->parameters())
+          .set("integrator", integrator_->parameters())
+          .set("computeFM", compute_fm_)
+          .set("mxRange", mx_range_)
+          .set("q2Range", steer<Limits>("q2Range"))
+          .set("numQ2", num_q2_)
+          .serialise();
+    }
+    /// Fill (or retrieve from the cache) the FE/FM table
+    std::unique_ptr<Table> buildTable() const {
+      auto table = std::make_unique<Table>(std::array<Limits, 1>{steer<Limits>("q2Range")},
+                                           std::array<size_t, 1>{static_cast<size_t>(num_q2_)});
+      // the structure functions and integrator objects are stateful, hence each thread builds its own copies
+      table->buildCached(
+          "formfac",
+          tableConfiguration(),
+          [this]() -> Table::Function {
+            const std::shared_ptr<strfun::Parameterisation> sf(
+                StructureFunctionsFactory::get().build(sf_->parameters()));
+            const std::shared_ptr<Integrator> integrator(IntegratorFactory::get().build(integrator_->parameters()));
+            return [this, sf, integrator](const auto& coord) { return integrate(*sf, *integrator, coord.at(0)); };
+          },
+          parameters());
+      return table;
+    }
+
     const std::unique_ptr<strfun::Parameterisation> sf_;
     const std::unique_ptr<Integrator> integrator_;
     const double compute_fm_;
     const Limits mx_range_, mx2_range_, dm2_range_;
-    const std::function<double(double)> eval_fe_, eval_fm_;
+    const int num_q2_;                            ///< Number of log(Q^2) nodes in the FE/FM table (0 if disabled)
+    mutable std::shared_ptr<const Table> table_;  ///< Optional log(Q^2) table of FE and FM values
+    mutable std::once_flag table_retrieved_;      ///< Has the table been retrieved (or built) already?
+    mutable std::mutex integration_mutex_;        ///< Serialisation of the out-of-table integrations
   };
 }  // namespace cepgen::formfac
 using cepgen::formfac::InelasticNucleon;
@@ -51,9 +51,9 @@ namespace cepgen::formfac {
         den += bs.at(i) * std::pow(tau, i + 1);
       return num / den;
     }
-    void eval() override {
-      const auto tau_value = tau(q2_);
-      setGEGM(computeFF(tau_value, ae_, be_), MU * computeFF(tau_value, am_, bm_));
+    FormFactors compute(double q2) const override {
+      const auto tau_value = tau(q2);
+      return fromGEGM(q2, computeFF(tau_value, ae_, be_), MU * computeFF(tau_value, am_, bm_));
     }
 
     const std::vector<double> ae_, be_, am_, bm_;
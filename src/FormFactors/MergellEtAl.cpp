@@ -84,14 +84,14 @@ namespace cepgen::formfac {
     }
 
   private:
-    void eval() override {
-      const double log1 = std::pow(std::log((lambda_sq_ + q2_) * inv_q20_), -gamma_);  // L(t=-q2) function in ref.
+    FormFactors compute(double q2) const override {
+      const double log1 = std::pow(std::log((lambda_sq_ + q2) * inv_q20_), -gamma_);  // L(t=-q2) function in ref.
       // best fit parameterisation
 
       // scalar part
       auto Fs1{0.}, Fs2{0.};
       for (size_t i = 0; i < d1_terms_.size(); i++) {
-        const auto d_1 = d1_terms_.at(i) + q2_;
+        const auto d_1 = d1_terms_.at(i) + q2;
         Fs1 += fs1_coefficients_.at(i) / d_1 * log1;
         Fs2 += fs2_coefficients_.at(i) / d_1 * log1;
       }
@@ -99,7 +99,7 @@ namespace cepgen::formfac {
       // vector part
       auto d_2 = d2_terms_;
       for (auto& d : d_2)
-        d += q2_;
+        d += q2;
       auto Fv1_term{0.}, Fv2_term{0.};
       for (size_t i = 0; i < d2_terms_.size(); i++) {
         Fv1_term += fv1_coefficients_.at(i) / d_2.at(i);
@@ -109,19 +109,19 @@ namespace cepgen::formfac {
                  log3 = std::pow(std::log((lambda_sq_ - 0.400) * inv_q20_), +gamma_);
       const auto Fv1 = (0.5 *
                             (rho1_coefficients_.at(0) * log2 +
-                             rho1_coefficients_.at(1) * log3 * std::pow(1. + q2_ / rho1_coefficients_.at(2), -2)) /
-                            (1. + q2_ / rho1_coefficients_.at(3)) +
+                             rho1_coefficients_.at(1) * log3 * std::pow(1. + q2 / rho1_coefficients_.at(2), -2)) /
+                            (1. + q2 / rho1_coefficients_.at(3)) +
                         Fv1_term) *
                        log1,
                  Fv2 = (0.5 *
                             (rho2_coefficients_.at(0) * log2 +
-                             rho2_coefficients_.at(1) * log3 / (1. + q2_ / rho2_coefficients_.at(2))) /
-                            (1. + q2_ / rho2_coefficients_.at(3)) +
+                             rho2_coefficients_.at(1) * log3 / (1. + q2 / rho2_coefficients_.at(2))) /
+                            (1. + q2 / rho2_coefficients_.at(3)) +
                         Fv2_term) *
                        log1;
 
       const auto F1 = Fv1 + Fs1, F2 = Fv2 + Fs2;
-      setGEGM(F1 - tau(q2_) * F2, F1 + F2);
+      return fromGEGM(q2, F1 - tau(q2) * F2, F1 + F2);
     }
 
     const std::vector<double> rho1_coefficients_, rho2_coefficients_;
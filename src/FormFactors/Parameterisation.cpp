@@ -19,6 +19,7 @@
 #include <cmath>
 #include <ostream>
 
+#include "CepGen/Core/Exception.h"
 #include "CepGen/FormFactors/Parameterisation.h"
 #include "CepGen/Physics/PDG.h"
 
@@ -44,6 +45,29 @@ const FormFactors& Parameterisation::operator()(double q2) {
   return ff_;
 }
 
+FormFactors Parameterisation::evaluate(double q2) const {
+  if (q2 < 0.)
+    return FormFactors{};
+  return compute(q2);
+}
+
+void Parameterisation::eval() {
+  if (in_eval_)
+    throw CG_FATAL("formfac:Parameterisation") << "Form factors parameterisation '" << name()
+                                               << "' implements neither a stateful nor a stateless evaluation method.";
+  ff_ = compute(q2_);
+}
+
+FormFactors Parameterisation::compute(double q2) const {
+  const std::lock_guard<std::mutex> lock(eval_mutex_);
+  auto& self = const_cast<Parameterisation&>(*this);  // stateful evaluation, hence its serialisation
+  self.in_eval_ = true;
+  self.q2_ = q2;
+  self.eval();
+  self.in_eval_ = false;
+  return ff_;
+}
+
 ParametersDescription Parameterisation::description() {
   auto desc = ParametersDescription();
   desc.setDescription("Unnamed form factors parameterisation");
@@ -51,20 +75,28 @@ ParametersDescription Parameterisation::description() {
   return desc;
 }
 
-void Parameterisation::setFEFM(double fe, double fm) {
-  ff_.FE = fe;
-  ff_.FM = fm;
-  ff_.GM = std::sqrt(ff_.FM);
-  const auto ta = tau(q2_);
-  ff_.GE = std::sqrt((1. + ta) * ff_.FE - ta * ff_.FM);
+void Parameterisation::setFEFM(double fe, double fm) { ff_ = fromFEFM(q2_, fe, fm); }
+
+void Parameterisation::setGEGM(double ge, double gm) { ff_ = fromGEGM(q2_, ge, gm); }
+
+FormFactors Parameterisation::fromFEFM(double q2, double fe, double fm) const {
+  FormFactors ff;
+  ff.FE = fe;
+  ff.FM = fm;
+  ff.GM = std::sqrt(ff.FM);
+  const auto ta = tau(q2);
+  ff.GE = std::sqrt((1. + ta) * ff.FE - ta * ff.FM);
+  return ff;
 }
 
-void Parameterisation::setGEGM(double ge, double gm) {
-  ff_.GE = ge;
-  ff_.GM = gm;
-  ff_.FM = ff_.GM * ff_.GM;
-  const auto ta = tau(q2_);
-  ff_.FE = (ff_.GE * ff_.GE + ta * ff_.FM) / (1. + ta);
+FormFactors Parameterisation::fromGEGM(double q2, double ge, double gm) const {
+  FormFactors ff;
+  ff.GE = ge;
+  ff.GM = gm;
+  ff.FM = ff.GM * ff.GM;
+  const auto ta = tau(q2);
+  ff.FE = (ff.GE * ff.GE + ta * ff.FM) / (1. + ta);
+  return ff;
 }
 
 //------------------------------------------------------------------
@@ -27,7 +27,7 @@ namespace cepgen::formfac {
         : Parameterisation(params), fe_(fe), fm_(fm) {}
 
   private:
-    void eval() override { setFEFM(fe_, fm_); }
+    FormFactors compute(double q2) const override { return fromFEFM(q2, fe_, fm_); }
     const double fe_, fm_;
   };
 
@@ -39,9 +39,9 @@ namespace cepgen::formfac {
     }
 
   protected:
-    void eval() override {
-      const auto ge = pow(1. + q2_ * inv_sq_scale_param_, -2.);
-      setGEGM(ge, MU * ge);
+    FormFactors compute(double q2) const override {
+      const auto ge = pow(1. + q2 * inv_sq_scale_param_, -2.);
+      return fromGEGM(q2, ge, MU * ge);
     }
 
   private:
@@ -64,21 +64,18 @@ namespace cepgen::formfac {
     }
 
   private:
-    void eval() override {
-      if (hi_ == HeavyIon::proton()) {
-        StandardDipole::eval();
-        return;
-      }
-      const auto qr2 = q2_ * a2_;
+    FormFactors compute(double q2) const override {
+      if (hi_ == HeavyIon::proton())
+        return StandardDipole::compute(q2);
+      const auto qr2 = q2 * a2_;
       if (static_cast<short>(hi_.Z) <= static_cast<short>(Element::C)) {  // Gaussian form factor for light nuclei
         const auto ge = std::exp(-qr2 / 6.);
-        setGEGM(ge, MU * ge);
-        return;
+        return fromGEGM(q2, ge, MU * ge);
       }
       const auto qr = std::sqrt(qr2), inv_qr = 1. / qr;
       const auto sph = (std::sin(qr) - qr * std::cos(qr)) * 3. * inv_qr * inv_qr;
-      const auto ge = sph / (1. + q2_ * a02_);
-      setGEGM(ge, MU * ge);
+      const auto ge = sph / (1. + q2 * a02_);
+      return fromGEGM(q2, ge, MU * ge);
     }
     const HeavyIon hi_;
     const double a2_, a02_;
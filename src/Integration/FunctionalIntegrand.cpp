@@ -23,6 +23,9 @@
 
 using namespace cepgen;
 
+FunctionalIntegrand::FunctionalIntegrand(const FunctionalIntegrand& oth)
+    : functional_(FunctionalFactory::get().build(oth.functional_->parameters())) {}
+
 FunctionalIntegrand::FunctionalIntegrand(const std::string& expression,
                                          const std::vector<std::string>& variables,
                                          const std::string& functional_evaluator)
@@ -47,3 +50,9 @@ size_t FunctionalIntegrand::size() const {
     throw CG_FATAL("FunctionalIntegrand:eval") << "Functional object was not properly initialised!";
   return functional_->variables().size();
 }
+
+std::unique_ptr<Integrand> FunctionalIntegrand::clone() const {
+  if (!functional_)
+    throw CG_FATAL("FunctionalIntegrand:clone") << "Functional object was not properly initialised!";
+  return std::unique_ptr<Integrand>(new FunctionalIntegrand(*this));
+}
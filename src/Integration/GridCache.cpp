@@ -0,0 +1,168 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <unistd.h>
+
+#include <cstring>
+#include <fstream>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Core/RunParameters.h"
+#include "CepGen/EventFilter/EventModifier.h"
+#include "CepGen/Integration/GridCache.h"
+#include "CepGen/Process/Process.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/Functional.h"
+#include "CepGen/Utils/String.h"
+
+using namespace cepgen;
+
+static constexpr char kMagic[] = "CGGRID01";  ///< File format identifier
+
+namespace {
+  /// 64-bit FNV-1a hash of a string, stable across platforms and runs
+  unsigned long long hash(const std::string& str) {
+    unsigned long long out = 0xcbf29ce484222325ull;
+    for (const auto& chr : str)
+      out = (out ^ static_cast<unsigned char>(chr)) * 0x100000001b3ull;
+    return out;
+  }
+  template <typename T>
+  void write(std::ostream& os, const T& value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+  template <typename T>
+  bool read(std::istream& is, T& value) {
+    return !!is.read(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+  void write(std::ostream& os, const std::vector<double>& vec) {
+    write<unsigned long long>(os, vec.size());
+    os.write(reinterpret_cast<const char*>(vec.data()), vec.size() * sizeof(double));
+  }
+  /// Number of bytes left to read in a stream
+  unsigned long long remainingSize(std::istream& is) {
+    const auto pos = is.tellg();
+    is.seekg(0, std::ios::end);
+    const auto end = is.tellg();
+    is.seekg(pos);
+    return pos < 0 || end < pos ? 0ull : static_cast<unsigned long long>(end - pos);
+  }
+  bool read(std::istream& is, std::vector<double>& vec) {
+    unsigned long long size;
+    if (!read(is, size) || size > remainingSize(is) / sizeof(double))  // never trust the stored size for allocation
+      return false;
+    vec.resize(size);
+    return !!is.read(reinterpret_cast<char*>(vec.data()), size * sizeof(double));
+  }
+}  // namespace
+
+GridCache::GridCache(const std::string& path, const RunParameters& run_parameters)
+    : path_(path),
+      configuration_(configuration(run_parameters)),
+      filename_((fs::path(path_) / utils::format("cepgen_grid_%016llx.bin", hash(configuration_))).string()) {
+  CG_DEBUG("GridCache") << "Grid cache file for this run configuration: '" << filename_ << "'.\n\t"
+                        << "Configuration: " << configuration_ << ".";
+}
+
+bool GridCache::load() {
+  std::ifstream file(filename_, std::ios::binary);
+  if (!file.good()) {
+    CG_DEBUG("GridCache:load") << "No grid cache file found at '" << filename_ << "'.";
+    return false;
+  }
+  char magic[sizeof(kMagic)];
+  unsigned long long configuration_size;
+  if (!file.read(magic, sizeof(kMagic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+      !read(file, configuration_size)) {
+    CG_WARNING("GridCache:load") << "Invalid grid cache file '" << filename_ << "'. It will be overwritten.";
+    return false;
+  }
+  // the stored configuration size is checked before allocating anything, as the file content is not trusted
+  std::string configuration;
+  if (configuration_size == configuration_.size()) {
+    configuration.resize(configuration_size);
+    file.read(configuration.data(), configuration_size);
+  }
+  if (!file || configuration != configuration_) {
+    CG_WARNING("GridCache:load") << "Grid cache file '" << filename_ << "' was produced for another run "
+                                 << "configuration. It will be overwritten.";
+    return false;
+  }
+  double cross_section, cross_section_error;
+  std::vector<double> integrator_state, worker_state;
+  if (!read(file, cross_section) || !read(file, cross_section_error) || !read(file, integrator_state) ||
+      !read(file, worker_state)) {
+    CG_WARNING("GridCache:load") << "Corrupted grid cache file '" << filename_ << "'. It will be overwritten.";
+    return false;
+  }
+  cross_section_ = Value{cross_section, cross_section_error};
+  integrator_state_ = std::move(integrator_state);
+  worker_state_ = std::move(worker_state);
+  CG_DEBUG("GridCache:load") << "Grids retrieved from cache file '" << filename_ << "'.";
+  return true;
+}
+
+void GridCache::store() const {
+  if (std::error_code err; !fs::create_directories(path_, err) && err)
+    throw CG_FATAL("GridCache:store") << "Failed to create the grid cache directory '" << path_
+                                      << "': " << err.message() << ".";
+  // write into a process-specific temporary file before moving it to its final destination, so that concurrent jobs
+  // sharing the same cache directory never read a partially written file
+  const auto tmp_filename = filename_ + "." + std::to_string(::getpid());
+  {
+    std::ofstream file(tmp_filename, std::ios::binary | std::ios::trunc);
+    if (!file.good())
+      throw CG_FATAL("GridCache:store") << "Failed to open the grid cache file '" << tmp_filename << "' for writing.";
+    file.write(kMagic, sizeof(kMagic));
+    write<unsigned long long>(file, configuration_.size());
+    file.write(configuration_.data(), configuration_.size());
+    write(file, static_cast<double>(cross_section_));
+    write(file, cross_section_.uncertainty());
+    write(file, integrator_state_);
+    write(file, worker_state_);
+  }
+  fs::rename(tmp_filename, filename_);
+  CG_DEBUG("GridCache:store") << "Grids stored into cache file '" << filename_ << "'.";
+}
+
+std::string GridCache::configuration(const RunParameters& run_parameters) {
+  // output modules, number of events to generate, random numbers streams used for the unweighting, number of threads,
+  // or unweighting batches size are left out, as they do not affect the grids, and are expected to differ between jobs
+  // sharing the same physics configuration
+  auto worker_params = run_parameters.generation().parameters().get<ParametersList>("worker");
+  worker_params.erase("randomGenerator");
+  worker_params.erase("numThreads");
+  worker_params.erase("numBatchTrials");
+  std::vector<std::string> taming_functions;
+  for (const auto& taming_function : run_parameters.tamingFunctions())
+    taming_functions.emplace_back(taming_function->variables().at(0) + ":" + taming_function->expression());
+  std::vector<ParametersList> event_modifiers;
+  for (const auto& event_modifier : run_parameters.eventModifiersSequence())
+    event_modifiers.emplace_back(event_modifier->parameters());
+  ParametersList configuration;
+  configuration.set("process", run_parameters.process().parameters())
+      .set("kinematics", run_parameters.kinematics().parameters())
+      .set("integrator", run_parameters.integrator())
+      .set("worker", worker_params)
+      .set("numPoints", static_cast<int>(run_parameters.generation().numPoints()))
+      .set("tamingFunctions", taming_functions)
+      .set("eventModifiers", event_modifiers);
+  if (run_parameters.generation().deferModification())  // generation grid maxima do not include branching fractions
+    configuration.set("deferModification", true);
+  return configuration.serialise();
+}
@@ -17,7 +17,7 @@
  */
 
 #include <cmath>
-#include <functional>
+#include <limits>
 
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Integration/GridParameters.h"
@@ -26,15 +26,34 @@
 
 using namespace cepgen;
 
-GridParameters::GridParameters(size_t m_bin, size_t num_dimensions)
+GridParameters::GridParameters(size_t m_bin, size_t num_dimensions, size_t max_memory)
     : mbin_(m_bin), inv_mbin_(1. / mbin_), num_dimensions_(num_dimensions) {
-  coord_t coordinate(num_dimensions, 0);
-  for (size_t i = 0; i < static_cast<size_t>(std::pow(mbin_, num_dimensions_)); ++i) {  // build and populate the grid
-    generateCoordinates(coordinate, i);
-    coordinates_.emplace_back(coordinate);
-    num_points_.emplace_back(0ul);
-    f_max_.emplace_back(0.);
+  if (mbin_ < 1 || mbin_ > std::numeric_limits<coord_t::value_type>::max())
+    throw CG_FATAL("GridParameters") << "Invalid grid size parameter: " << mbin_ << ".";
+  size_t num_bins = 1;  // integer power, with overflow protection
+  for (size_t i = 0; i < num_dimensions_; ++i) {
+    if (num_bins > std::numeric_limits<size_t>::max() / mbin_)
+      throw CG_FATAL("GridParameters") << "Grid multiplicity overflow for a dim-" << num_dimensions_ << " phase space "
+                                       << "with " << mbin_ << " bins per dimension.";
+    num_bins *= mbin_;
   }
+  if (num_bins > max_memory / kBinMemory)
+    throw CG_FATAL("GridParameters") << "Generation grid for a dim-" << num_dimensions_ << " phase space with " << mbin_
+                                     << " bins per dimension (" << num_bins << " bins) would require "
+                                     << 1. * num_bins * kBinMemory / (1ull << 20) << " MiB of memory, above the "
+                                     << (max_memory >> 20) << " MiB budget. Reduce the number of bins per dimension "
+                                     << "or increase the memory budget.";
+  num_points_.assign(num_bins, 0u);
+  f_max_.assign(num_bins, 0.f);
+}
+
+GridParameters::coord_t GridParameters::n(size_t coord) const {
+  if (coord >= size())
+    throw CG_FATAL("GridParameters:n") << "Invalid grid coordinate: " << coord << " >= " << size() << ".";
+  coord_t coordinates(num_dimensions_);
+  for (size_t j = 0; j < num_dimensions_; ++j, coord /= mbin_)
+    coordinates[j] = coord % mbin_;
+  return coordinates;
 }
 
 void GridParameters::setValue(size_t coordinate, float value) {
@@ -46,39 +65,46 @@ void GridParameters::setValue(size_t coordinate, float value) {
 void GridParameters::shoot(utils::RandomGenerator& random_generator,
                            size_t coordinate,
                            std::vector<double>& out) const {
-  const auto& nv = coordinates_.at(coordinate);
-  out.resize(nv.size());
-  for (size_t i = 0; i < nv.size(); ++i)
-    out[i] = (random_generator.uniform() + nv.at(i)) * inv_mbin_;
+  shoot(random_generator, coordinate, 1, out);
+}
+
+void GridParameters::shoot(utils::RandomGenerator& random_generator,
+                           size_t coordinate,
+                           size_t num_points,
+                           std::vector<double>& out) const {
+  if (coordinate >= size())
+    throw CG_FATAL("GridParameters:shoot") << "Invalid grid coordinate: " << coordinate << " >= " << size() << ".";
+  out.resize(num_points * num_dimensions_);
+  random_generator.fillUniform(out);  // draw all uniform numbers at once
+  for (size_t j = 0; j < num_dimensions_; ++j, coordinate /= mbin_) {  // decode the bin coordinates on-the-fly
+    const auto offset = static_cast<double>(coordinate % mbin_);
+    for (size_t i = 0; i < num_points; ++i)
+      out[i * num_dimensions_ + j] = (out[i * num_dimensions_ + j] + offset) * inv_mbin_;
+  }
 }
 
 void GridParameters::dump() const {
   CG_INFO("GridParameters:dump").log([&](auto& info) {
-    for (size_t i = 0; i < coordinates_.size(); ++i)
+    for (size_t i = 0; i < size(); ++i)
       info << "\nn[" << i << "]: "
-           << "coord=" << coordinates_.at(i) << ", "
+           << "coord=" << n(i) << ", "
            << "num points: " << num_points_.at(i) << ", "
            << "max=" << f_max_.at(i) << ".";
   });
 }
 
-void GridParameters::generateCoordinates(coord_t& coord, size_t i) const {
-  size_t jj = i;
-  for (size_t j = 0; j < num_dimensions_; ++j) {
-    const size_t tmp = jj * inv_mbin_;
-    coord[j] = jj - tmp * mbin_;
-    jj = tmp;
-  }
-}
-
 bool GridParameters::correct(size_t bin) {
   if (f_max2_ <= f_max_.at(bin))
     return true;
   f_max_old_ = f_max_.at(bin);
   f_max_diff_ = f_max2_ - f_max_old_;
-  correction_ = (num_points_.at(bin) - 1.) * f_max_diff_ / f_max_global_;
-  if (f_max2_ >= f_max_global_)
-    correction_ *= f_max2_ / f_max_global_;
+  if (proportional_selection_)  // bin was selected with a probability proportional to its former maximum
+    correction_ = (num_points_.at(bin) - 1.) * f_max_diff_ / f_max_old_;
+  else {
+    correction_ = (num_points_.at(bin) - 1.) * f_max_diff_ / f_max_global_;
+    if (f_max2_ >= f_max_global_)
+      correction_ *= f_max2_ / f_max_global_;
+  }
   setValue(bin, f_max2_);
   correction_ -= correction2_;
   correction2_ = 0.;
@@ -98,7 +124,8 @@ void GridParameters::initCorrectionCycle(size_t bin, float weight) {
   f_max_old_ = f_max_.at(bin);
   f_max_diff_ = weight - f_max_old_;
   setValue(bin, weight);
-  correction_ = (num_points_.at(bin) - 1) * f_max_diff_ / f_max_global_ - 1.;
+  correction_ =
+      (num_points_.at(bin) - 1.) * f_max_diff_ / (proportional_selection_ ? f_max_old_ : f_max_global_) - 1.;
   CG_DEBUG("GridParameters:initCorrectionCycle")
       << "Correction " << correction_ << " will be applied "
       << "for phase space bin " << bin << " (" << utils::s("point", num_points_.at(bin), true) << "). "
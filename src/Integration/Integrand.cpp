@@ -0,0 +1,42 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Integration/Integrand.h"
+
+using namespace cepgen;
+
+void Integrand::evalBatch(const std::vector<double>& points, std::vector<double>& weights) {
+  const auto num_dimensions = size();
+  if (num_dimensions == 0 || points.size() % num_dimensions != 0)
+    throw CG_FATAL("Integrand:evalBatch") << "Invalid coordinates multiplicity: " << points.size()
+                                          << " values cannot be split into dim-" << num_dimensions << " points.";
+  const auto num_points = points.size() / num_dimensions;
+  weights.resize(num_points);
+  std::vector<double> coordinates(num_dimensions);
+  for (size_t i = 0; i < num_points; ++i) {
+    std::copy(points.begin() + i * num_dimensions, points.begin() + (i + 1) * num_dimensions, coordinates.begin());
+    weights[i] = eval(coordinates);
+  }
+}
+
+std::unique_ptr<Integrand> Integrand::clone() const {
+  throw CG_FATAL("Integrand:clone") << "This integrand cannot be cloned.";
+}
@@ -26,6 +26,25 @@ Integrator::Integrator(const ParametersList& params) : NamedModule(params), verb
 
 double Integrator::eval(Integrand& integrand, const std::vector<double>& x) const { return integrand.eval(x); }
 
+void Integrator::treat(size_t ndim,
+                       const std::vector<double>& points,
+                       std::vector<double>& treated_points,
+                       std::vector<double>& jacobians) const {
+  treated_points = points;
+  jacobians.assign(ndim > 0 ? points.size() / ndim : 0, 1.);
+}
+
+void Integrator::evalBatch(Integrand& integrand,
+                           const std::vector<double>& points,
+                           std::vector<double>& weights) const {
+  // buffers are kept per thread, as this method may be called concurrently by several generator workers
+  thread_local std::vector<double> treated_points, jacobians;
+  treat(integrand.size(), points, treated_points, jacobians);
+  integrand.evalBatch(treated_points, weights);
+  for (size_t i = 0; i < weights.size(); ++i)
+    weights[i] *= jacobians[i];
+}
+
 Value Integrator::integrate(Integrand& integrand, const std::vector<Limits>& range) {
   if (range.size() < integrand.size()) {
     auto normalised_range = range;
@@ -0,0 +1,181 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <utility>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Integration/Integrand.h"
+#include "CepGen/Integration/ParallelIntegrator.h"
+#include "CepGen/Modules/RandomGeneratorFactory.h"
+#include "CepGen/Utils/RandomGenerator.h"
+
+using namespace cepgen;
+using namespace std::string_literals;
+
+ParallelIntegrator::ParallelIntegrator(const ParametersList& params)
+    : Integrator(params),
+      random_generator_(RandomGeneratorFactory::get().build(steer<ParametersList>("randomGenerator"))),
+      batch_size_(steer<int>("batchSize")),
+      num_threads_(steer<int>("numThreads")) {
+  if (const auto batch_size = steer<int>("batchSize"); batch_size <= 0)
+    throw CG_FATAL("ParallelIntegrator") << "Invalid points batch size: " << batch_size << ".";
+}
+
+ParallelIntegrator::~ParallelIntegrator() { stopWorkers(); }
+
+void ParallelIntegrator::prepare(Integrand& integrand, const std::vector<Limits>& range) {
+  const auto num_dimensions = integrand.size();
+  if (num_dimensions == 0)
+    throw CG_FATAL("ParallelIntegrator:prepare") << "Invalid phase space dimension: " << num_dimensions << ".";
+  if (range.size() < num_dimensions)
+    throw CG_FATAL("ParallelIntegrator:prepare")
+        << "Insufficient number of limits (" << range << ") provided for dim-" << num_dimensions << " integrand.";
+  x_low_.resize(num_dimensions);
+  x_high_.resize(num_dimensions);
+  for (size_t i = 0; i < num_dimensions; ++i)
+    x_low_[i] = range.at(i).min(), x_high_[i] = range.at(i).max();
+
+  // build the pool of integrands (one independent copy per thread)
+  const size_t num_threads = num_threads_ > 0 ? num_threads_ : std::max(std::thread::hardware_concurrency(), 1u);
+  const auto num_workers = workers_.size();
+  integrands_ = {&integrand};
+  clones_.clear();
+  while (integrands_.size() < num_threads) {
+    try {
+      integrands_.emplace_back(clones_.emplace_back(integrand.clone()).get());
+    } catch (const Exception& exc) {
+      CG_WARNING("ParallelIntegrator:prepare")
+          << "Failed to clone the integrand for an additional evaluation thread. Will use "
+          << integrands_.size() << " thread(s).\n\t" << exc.message();
+      break;
+    }
+  }
+  thread_points_.assign(integrands_.size(), {});
+  thread_weights_.assign(integrands_.size(), {});
+  thread_errors_.assign(integrands_.size(), nullptr);
+  if (workers_.empty() || num_workers + 1 != integrands_.size()) {  // threads pool is only rebuilt if needed
+    stopWorkers();
+    startWorkers();
+  }
+  CG_DEBUG("ParallelIntegrator:prepare") << "Dim-" << num_dimensions << " integrand will be evaluated in batches of "
+                                         << batch_size_ << " points over " << integrands_.size() << " thread(s).";
+}
+
+void ParallelIntegrator::shoot(size_t num_points,
+                               const std::vector<double>& x_low,
+                               const std::vector<double>& x_high,
+                               std::vector<double>& points) const {
+  const auto num_dimensions = x_low.size();
+  points.resize(num_points * num_dimensions);
+  for (size_t i = 0; i < num_points; ++i)
+    for (size_t j = 0; j < num_dimensions; ++j)
+      points[i * num_dimensions + j] = random_generator_->uniform(x_low[j], x_high[j]);
+}
+
+void ParallelIntegrator::evalBatch(const std::vector<double>& points, std::vector<double>& weights) {
+  if (integrands_.empty())
+    throw CG_FATAL("ParallelIntegrator:evalBatch") << "Integrands pool was not prepared.";
+  const auto num_dimensions = ndim(), num_points = points.size() / num_dimensions;
+  weights.resize(num_points);
+  if (numThreads() == 1 || num_points < numThreads()) {  // no need to dispatch the evaluation
+    integrands_.at(0)->evalBatch(points, weights);
+    return;
+  }
+  const auto chunk_size = (num_points + numThreads() - 1) / numThreads();
+  size_t num_chunks = 0;
+  for (size_t first = 0; first < num_points; first += chunk_size, ++num_chunks)
+    thread_points_.at(num_chunks).assign(points.begin() + first * num_dimensions,
+                                         points.begin() + std::min(first + chunk_size, num_points) * num_dimensions);
+  {  // wake up the evaluation threads
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    num_chunks_ = num_chunks;
+    num_pending_chunks_ = num_chunks - 1;
+    ++batch_id_;
+  }
+  batch_ready_.notify_all();
+  try {  // first chunk is evaluated in the current thread
+    integrands_.at(0)->evalBatch(thread_points_.at(0), thread_weights_.at(0));
+  } catch (...) {
+    thread_errors_.at(0) = std::current_exception();
+  }
+  {  // wait for all threads
+    std::unique_lock<std::mutex> lock(pool_mutex_);
+    batch_done_.wait(lock, [this] { return num_pending_chunks_ == 0; });
+  }
+  std::exception_ptr error;  // propagate the first exception raised while evaluating the integrand, if any
+  for (auto& thread_error : thread_errors_)
+    if (auto exception = std::exchange(thread_error, nullptr); exception && !error)
+      error = exception;
+  if (error)
+    std::rethrow_exception(error);
+  // gather the partial results in the order of the input batch
+  for (size_t i = 0; i < num_chunks; ++i)
+    std::copy(thread_weights_.at(i).begin(), thread_weights_.at(i).end(), weights.begin() + i * chunk_size);
+}
+
+void ParallelIntegrator::startWorkers() {
+  stop_workers_ = false;
+  for (size_t i = 1; i < integrands_.size(); ++i)
+    workers_.emplace_back(&ParallelIntegrator::workerLoop, this, i, batch_id_);
+}
+
+void ParallelIntegrator::stopWorkers() {
+  {
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    stop_workers_ = true;
+  }
+  batch_ready_.notify_all();
+  for (auto& worker : workers_)
+    worker.join();
+  workers_.clear();
+}
+
+void ParallelIntegrator::workerLoop(size_t thread_id, size_t last_batch_id) {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(pool_mutex_);
+      batch_ready_.wait(lock, [this, &last_batch_id] { return stop_workers_ || batch_id_ != last_batch_id; });
+      if (stop_workers_)
+        return;
+      last_batch_id = batch_id_;
+      if (thread_id >= num_chunks_)  // this thread is not involved in the current batch
+        continue;
+    }
+    try {
+      integrands_.at(thread_id)->evalBatch(thread_points_.at(thread_id), thread_weights_.at(thread_id));
+    } catch (...) {
+      thread_errors_.at(thread_id) = std::current_exception();
+    }
+    {
+      std::lock_guard<std::mutex> lock(pool_mutex_);
+      if (--num_pending_chunks_ == 0)
+        batch_done_.notify_one();
+    }
+  }
+}
+
+ParametersDescription ParallelIntegrator::description() {
+  auto desc = Integrator::description();
+  desc.add("randomGenerator",
+           RandomGeneratorFactory::get().describeParameters("stl", ParametersList().set("type", "mt19937_64"s)))
+      .setDescription("random number generator engine used to sample the phase space points");
+  desc.add("numThreads", 0).setDescription("number of integrand evaluation threads (0 for all available cores)");
+  desc.add("batchSize", 10'000).setDescription("maximal number of points to be evaluated in one batch");
+  return desc;
+}
@@ -0,0 +1,171 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Integration/ParallelIntegrator.h"
+#include "CepGen/Modules/IntegratorFactory.h"
+#include "CepGen/Utils/RandomGenerator.h"
+
+using namespace cepgen;
+
+/// Multithreaded version of the MISER recursive stratified sampling algorithm developed by W.H. Press and G.R. Farrar,
+/// as documented in \cite Press:1989vk.
+class ParallelMISERIntegrator final : public ParallelIntegrator {
+public:
+  explicit ParallelMISERIntegrator(const ParametersList& params)
+      : ParallelIntegrator(params),
+        num_function_calls_(steer<int>("numFunctionCalls")),
+        estimate_fraction_(steer<double>("estimateFraction")),
+        min_calls_(steer<int>("minCalls")),
+        min_calls_per_bisection_(steer<int>("minCallsPerBisection")),
+        alpha_(steer<double>("alpha")),
+        dither_(steer<double>("dither")) {
+    if (min_calls_ < 2 || min_calls_per_bisection_ < 2 * min_calls_)
+      throw CG_FATAL("ParallelMISERIntegrator") << "Invalid MISER parameters: minimum calls=" << min_calls_
+                                                << ", minimum calls per bisection=" << min_calls_per_bisection_ << ".";
+  }
+
+  static ParametersDescription description() {
+    auto desc = ParallelIntegrator::description();
+    desc.setDescription("Multithreaded MISER recursive stratified sampling integrator");
+    desc.add("numFunctionCalls", 50'000).setDescription("number of function calls per phase space point evaluation");
+    desc.add("estimateFraction", 0.1)
+        .setDescription(
+            "fraction of the currently available number of function calls allocated to estimating the variance at each "
+            "recursive step");
+    desc.add("minCalls", 16 * 10)
+        .setDescription("minimum number of function calls required for each estimate of the variance");
+    desc.add("minCallsPerBisection", 32 * 16 * 10)
+        .setDescription("minimum number of function calls required to proceed with a bisection step");
+    desc.add("alpha", 2.)
+        .setDescription(
+            "how the estimated variances for the two sub-regions of a bisection are combined when allocating points");
+    desc.add("dither", 0.1)
+        .setDescription(
+            "size of the random fractional variation into each bisection, which can be used to break the symmetry of "
+            "integrands which are concentrated near the exact center of the hypercubic integration region");
+    return desc;
+  }
+
+  Value run(Integrand& integrand, const std::vector<Limits>& range) override {
+    prepare(integrand, range);
+    const auto [result, variance] = integrateRegion(x_low_, x_high_, num_function_calls_);
+    return Value{result, std::sqrt(variance)};
+  }
+
+private:
+  /// Recursively integrate the function over a sub-region of the phase space
+  /// \param[in] x_low Lower bounds of the region
+  /// \param[in] x_high Upper bounds of the region
+  /// \param[in] num_calls Number of function calls allocated to this region
+  /// \return Integral estimate over the region, and its variance
+  std::pair<double, double> integrateRegion(const std::vector<double>& x_low,
+                                            const std::vector<double>& x_high,
+                                            size_t num_calls) {
+    const auto num_estimate_calls = std::max(min_calls_, static_cast<size_t>(estimate_fraction_ * num_calls));
+    if (num_calls < min_calls_per_bisection_ || num_calls < num_estimate_calls + 2 * min_calls_)
+      return integratePlain(x_low, x_high, std::max(num_calls, size_t{2}));
+
+    // estimate the variance on each half of the region, for all possible bisections
+    const auto dither = dither_ > 0. ? random_generator_->uniform(-dither_, dither_) : 0.;
+    std::vector<double> x_mid(ndim());
+    for (size_t j = 0; j < ndim(); ++j)
+      x_mid[j] = x_low[j] + (0.5 + dither) * (x_high[j] - x_low[j]);
+    std::vector<Moments> left(ndim()), right(ndim());
+    for (size_t num_points = 0; num_points < num_estimate_calls;) {  // points are shot and evaluated by batches
+      shoot(std::min(batch_size_, num_estimate_calls - num_points), x_low, x_high, points_);
+      evalBatch(points_, weights_);
+      for (size_t i = 0; i < weights_.size(); ++i)
+        for (size_t j = 0; j < ndim(); ++j)
+          (points_[i * ndim() + j] <= x_mid[j] ? left : right)[j].add(weights_[i]);
+      num_points += weights_.size();
+    }
+
+    // find the bisection direction minimising the sum of the variances
+    size_t best_dim = ndim();
+    auto best_sum = 0., best_left = 0., best_right = 0.;
+    for (size_t j = 0; j < ndim(); ++j) {
+      const auto sig_left = left[j].scaledSigma(alpha_), sig_right = right[j].scaledSigma(alpha_);
+      if (sig_left < 0. || sig_right < 0.)  // not enough points to estimate the variance on one side
+        continue;
+      if (best_dim == ndim() || sig_left + sig_right < best_sum)
+        best_dim = j, best_sum = sig_left + sig_right, best_left = sig_left, best_right = sig_right;
+    }
+    if (best_dim == ndim())  // no information collected; pick a random direction
+      best_dim = random_generator_->uniformInt(0, ndim() - 1);
+
+    // allocate the remaining function calls between both halves
+    const auto fraction_left = (x_mid[best_dim] - x_low[best_dim]) / (x_high[best_dim] - x_low[best_dim]);
+    const auto norm = fraction_left * best_left + (1. - fraction_left) * best_right;
+    const auto real_fraction_left = norm > 0. ? fraction_left * best_left / norm : fraction_left;
+    const auto num_remaining_calls = num_calls - num_estimate_calls;
+    const auto num_calls_left =
+        min_calls_ + static_cast<size_t>((num_remaining_calls - 2 * min_calls_) * real_fraction_left);
+
+    auto x_high_left = x_high, x_low_right = x_low;
+    x_high_left[best_dim] = x_low_right[best_dim] = x_mid[best_dim];
+    const auto [result_left, variance_left] = integrateRegion(x_low, x_high_left, num_calls_left);
+    const auto [result_right, variance_right] =
+        integrateRegion(x_low_right, x_high, num_remaining_calls - num_calls_left);
+    return std::make_pair(result_left + result_right, variance_left + variance_right);
+  }
+  /// Plain Monte Carlo integration over a sub-region of the phase space
+  std::pair<double, double> integratePlain(const std::vector<double>& x_low,
+                                           const std::vector<double>& x_high,
+                                           size_t num_calls) {
+    auto volume = 1.;
+    for (size_t j = 0; j < ndim(); ++j)
+      volume *= x_high[j] - x_low[j];
+    Moments moments;
+    while (moments.num_points < num_calls) {
+      shoot(std::min(batch_size_, num_calls - moments.num_points), x_low, x_high, points_);
+      evalBatch(points_, weights_);
+      for (const auto& weight : weights_)
+        moments.add(weight);
+    }
+    return std::make_pair(volume * moments.mean, volume * volume * moments.variance() / moments.num_points);
+  }
+
+  /// Running mean and variance of a collection of function values
+  struct Moments {
+    void add(double value) {
+      const auto delta = value - mean;
+      mean += delta / ++num_points;
+      sum_sq_diff += delta * (value - mean);
+    }
+    inline double variance() const { return num_points > 1 ? sum_sq_diff / (num_points - 1.) : 0.; }
+    /// Standard deviation estimate, scaled for the calls allocation (negative if undefined)
+    inline double scaledSigma(double alpha) const {
+      return num_points > 1 ? std::pow(std::sqrt(variance()), 2. / (1. + alpha)) : -1.;
+    }
+    size_t num_points{0};
+    double mean{0.}, sum_sq_diff{0.};
+  };
+
+  const size_t num_function_calls_;
+  const double estimate_fraction_;
+  const size_t min_calls_;
+  const size_t min_calls_per_bisection_;
+  const double alpha_;
+  const double dither_;
+  std::vector<double> points_, weights_;
+};
+REGISTER_INTEGRATOR("MISER_mt", ParallelMISERIntegrator);
@@ -0,0 +1,66 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Integration/ParallelIntegrator.h"
+#include "CepGen/Modules/IntegratorFactory.h"
+
+using namespace cepgen;
+
+/// Plain integration algorithm randomly sampling batches of points in the phase space over several threads
+class ParallelPlainIntegrator final : public ParallelIntegrator {
+public:
+  explicit ParallelPlainIntegrator(const ParametersList& params)
+      : ParallelIntegrator(params), num_function_calls_(steer<int>("numFunctionCalls")) {}
+
+  static ParametersDescription description() {
+    auto desc = ParallelIntegrator::description();
+    desc.setDescription("Multithreaded plain (trial/error) integrator");
+    desc.add("numFunctionCalls", 50'000).setDescription("number of function calls per phase space point evaluation");
+    return desc;
+  }
+
+  Value run(Integrand& integrand, const std::vector<Limits>& range) override {
+    prepare(integrand, range);
+    if (num_function_calls_ < 2)
+      throw CG_FATAL("ParallelPlainIntegrator") << "At least two function calls are required to estimate the error.";
+    auto volume = 1.;
+    for (size_t i = 0; i < ndim(); ++i)
+      volume *= x_high_.at(i) - x_low_.at(i);
+    // running mean and variance of the function values
+    size_t num_evaluated = 0;
+    auto mean = 0., sum_sq_diff = 0.;
+    while (num_evaluated < num_function_calls_) {
+      shoot(std::min(batch_size_, num_function_calls_ - num_evaluated), x_low_, x_high_, points_);
+      evalBatch(points_, weights_);
+      for (const auto& weight : weights_) {
+        const auto delta = weight - mean;
+        mean += delta / ++num_evaluated;
+        sum_sq_diff += delta * (weight - mean);
+      }
+    }
+    return Value{volume * mean, volume * std::sqrt(sum_sq_diff / (num_evaluated * (num_evaluated - 1.)))};
+  }
+
+private:
+  const size_t num_function_calls_;
+  std::vector<double> points_, weights_;
+};
+REGISTER_INTEGRATOR("plain_mt", ParallelPlainIntegrator);
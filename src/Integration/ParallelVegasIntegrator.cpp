@@ -0,0 +1,272 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Integration/Integrand.h"
+#include "CepGen/Integration/ParallelIntegrator.h"
+#include "CepGen/Integration/VegasGrid.h"
+#include "CepGen/Modules/IntegratorFactory.h"
+#include "CepGen/Utils/String.h"
+
+using namespace cepgen;
+
+/// Multithreaded version of the Vegas importance sampling integration algorithm developed by P. Lepage,
+/// as documented in \cite Lepage:1977sw
+class ParallelVegasIntegrator final : public ParallelIntegrator {
+public:
+  explicit ParallelVegasIntegrator(const ParametersList& params)
+      : ParallelIntegrator(params),
+        num_function_calls_(steer<int>("numFunctionCalls")),
+        num_warmup_calls_(steer<int>("numWarmupCalls")),
+        num_iterations_(steer<int>("iterations")),
+        num_bins_(steer<int>("numBins")),
+        chi_square_cut_(steer<double>("chiSqCut")),
+        alpha_(steer<double>("alpha")),
+        treat_(steer<bool>("treat")) {
+    if (num_iterations_ == 0 || num_bins_ < 2)
+      throw CG_FATAL("ParallelVegasIntegrator") << "Invalid Vegas parameters: iterations=" << num_iterations_
+                                                << ", number of bins=" << num_bins_ << ".";
+  }
+
+  static ParametersDescription description() {
+    auto desc = ParallelIntegrator::description();
+    desc.setDescription("Multithreaded Vegas importance sampling integrator");
+    desc.add("numFunctionCalls", 100'000).setDescription("number of function calls per phase space point evaluation");
+    desc.add("numWarmupCalls", 25'000).setDescription("number of function calls for the grid warm-up");
+    desc.add("chiSqCut", 1.5).setDescription("maximum (normalised) chi^2 to reach before stopping iterations");
+    desc.add("treat", true).setDescription("phase space treatment");
+    desc.add("iterations", 10).setDescription("number of iterations to perform for each call to the routine");
+    desc.add("numBins", 50).setDescription("number of grid bins along each dimension");
+    desc.add("alpha", 1.25).setDescription("stiffness of the rebinning algorithm");
+    return desc;
+  }
+
+  Value run(Integrand& integrand, const std::vector<Limits>& range) override {
+    prepare(integrand, range);
+    volume_ = 1.;
+    for (size_t j = 0; j < ndim(); ++j)
+      volume_ *= x_high_.at(j) - x_low_.at(j);
+    // start from a uniform grid
+    grid_.resize((num_bins_ + 1) * ndim());
+    for (size_t i = 0; i <= num_bins_; ++i)
+      for (size_t j = 0; j < ndim(); ++j)
+        xi(i, j) = i * 1. / num_bins_;
+
+    integrate(num_warmup_calls_);  // warmup (prepare the grid)
+    CG_INFO("ParallelVegasIntegrator:warmup") << "Finished the Vegas warm-up.";
+
+    // integration phase
+    unsigned short num_calls = 0;
+    Value result;
+    double chi_square;
+    do {
+      std::tie(result, chi_square) = integrate(0.2 * num_function_calls_);
+      CG_LOG << "\t>> at call " << (++num_calls) << ": "
+             << utils::format("average = %10.6f   sigma = %10.6f   chi2 = %4.3f.",
+                              static_cast<double>(result),
+                              result.uncertainty(),
+                              chi_square);
+    } while (result.uncertainty() > 0. && std::fabs(chi_square - 1.) > chi_square_cut_ - 1.);
+    return result;
+  }
+
+  std::vector<double> state() const override {
+    if (grid_.empty())
+      return {};
+    std::vector<double> state{static_cast<double>(ndim()), static_cast<double>(num_bins_)};
+    state.insert(state.end(), grid_.begin(), grid_.end());
+    return state;
+  }
+  bool setState(const std::vector<double>& state) override {
+    if (state.size() < 2 || state.at(1) != num_bins_ || !(state.at(0) >= 1. && state.at(0) < state.size()))
+      return false;
+    const auto dim = static_cast<size_t>(state.at(0));
+    if (state.size() != 2 + (num_bins_ + 1) * dim)
+      return false;
+    x_low_.assign(dim, 0.);
+    x_high_.assign(dim, 1.);
+    grid_.assign(state.begin() + 2, state.end());
+    return true;
+  }
+
+  double eval(Integrand& integrand, const std::vector<double>& coordinates) const override {
+    if (!treat_)  // by default, no grid treatment
+      return integrand.eval(coordinates);
+    // treatment of the integration grid (stateless, as it may be called concurrently by several generator workers)
+    thread_local std::vector<double> treated_coordinates, jacobian;
+    treat(coordinates.size(), coordinates, treated_coordinates, jacobian);
+    return jacobian.at(0) * integrand.eval(treated_coordinates);
+  }
+  void treat(size_t ndim,
+             const std::vector<double>& points,
+             std::vector<double>& treated_points,
+             std::vector<double>& jacobians) const override {
+    if (!treat_)
+      return Integrator::treat(ndim, points, treated_points, jacobians);
+    if (grid_.empty())
+      throw CG_FATAL("ParallelVegasIntegrator:treat") << "Vegas grid was not prepared.";
+    vegas::treat(grid_.data(), num_bins_, ndim, points, treated_points, jacobians);
+  }
+
+private:
+  inline double& xi(size_t i, size_t j) { return grid_[i * ndim() + j]; }
+  inline double xi(size_t i, size_t j) const { return grid_[i * ndim() + j]; }
+
+  /// Map a unit coordinate onto the adapted grid
+  /// \param[in] y uniform coordinate
+  /// \param[in] j dimension index
+  /// \param[inout] jacobian Jacobian of the transformation, to be updated
+  /// \param[out] bin Grid bin index in which the coordinate falls (if requested)
+  /// \return Coordinate in the unit hypercube, distributed according to the grid
+  double map(double y, size_t j, double& jacobian, size_t* bin = nullptr) const {
+    const auto z = y * num_bins_;
+    const auto k = std::min(static_cast<size_t>(z), num_bins_ - 1);
+    const auto bin_width = xi(k + 1, j) - xi(k, j);
+    jacobian *= num_bins_ * bin_width;
+    if (bin)
+      *bin = k;
+    return xi(k, j) + bin_width * (z - k);
+  }
+
+  /// Perform a set of Vegas iterations, adapting the grid after each of them
+  /// \param[in] num_calls Total number of function calls for all iterations
+  /// \return Weighted average of all iterations, and chi^2 per degree of freedom of their compatibility
+  std::pair<Value, double> integrate(size_t num_calls) {
+    const auto num_points = std::max(num_calls / num_iterations_, size_t{2});
+    const std::vector<double> unit_low(ndim(), 0.), unit_high(ndim(), 1.);
+    std::vector<double> jacobians(std::min(num_points, batch_size_));
+    std::vector<Value> iterations_results;
+    for (size_t it = 0; it < num_iterations_; ++it) {
+      distribution_.assign(num_bins_ * ndim(), 0.);
+      auto mean = 0., sum_sq_diff = 0.;
+      // points are drawn and evaluated by batches, in the same order as for a single batch
+      for (size_t first = 0; first < num_points; first += batch_size_) {
+        const auto batch_size = std::min(batch_size_, num_points - first);
+        shoot(batch_size, unit_low, unit_high, unit_points_);  // uniform sampling
+        points_.resize(unit_points_.size());
+        bins_.resize(unit_points_.size());
+        for (size_t i = 0; i < batch_size; ++i) {
+          jacobians[i] = volume_;
+          for (size_t j = 0; j < ndim(); ++j) {
+            const auto idx = i * ndim() + j;
+            points_[idx] =
+                x_low_[j] + (x_high_[j] - x_low_[j]) * map(unit_points_[idx], j, jacobians[i], &bins_[idx]);
+          }
+        }
+        evalBatch(points_, weights_);
+        // collect the iteration results and the per-bin contributions to the variance
+        for (size_t i = 0; i < batch_size; ++i) {
+          const auto value = weights_[i] * jacobians[i], delta = value - mean;
+          mean += delta / (first + i + 1.);
+          sum_sq_diff += delta * (value - mean);
+          for (size_t j = 0; j < ndim(); ++j)
+            distribution_[bins_[i * ndim() + j] * ndim() + j] += value * value;
+        }
+      }
+      iterations_results.emplace_back(mean, std::sqrt(sum_sq_diff / (num_points * (num_points - 1.))));
+      refineGrid();
+    }
+    // weighted average of all iterations
+    auto sum_weights = 0., sum_weighted_results = 0.;
+    for (const auto& res : iterations_results)
+      if (res.uncertainty() > 0.) {
+        const auto weight = 1. / (res.uncertainty() * res.uncertainty());
+        sum_weights += weight;
+        sum_weighted_results += weight * res;
+      }
+    if (sum_weights <= 0.)  // all iterations returned an exact result
+      return std::make_pair(iterations_results.back(), 0.);
+    const auto average = sum_weighted_results / sum_weights;
+    auto chi_square = 0.;
+    for (const auto& res : iterations_results)
+      if (res.uncertainty() > 0.)
+        chi_square += std::pow((res - average) / res.uncertainty(), 2);
+    if (iterations_results.size() > 1)
+      chi_square /= iterations_results.size() - 1.;
+    return std::make_pair(Value{average, std::sqrt(1. / sum_weights)}, chi_square);
+  }
+
+  /// Grid refinement from the per-bin variance contributions (following GSL's implementation)
+  void refineGrid() {
+    std::vector<double> weights(num_bins_), new_grid(num_bins_ + 1);
+    for (size_t j = 0; j < ndim(); ++j) {
+      const auto d = [this, &j](size_t i) -> double& { return distribution_[i * ndim() + j]; };
+      // smooth the distribution
+      auto old_value = d(0), new_value = d(1);
+      d(0) = 0.5 * (old_value + new_value);
+      auto grid_total = d(0);
+      for (size_t i = 1; i < num_bins_ - 1; ++i) {
+        const auto sum = old_value + new_value;
+        old_value = new_value;
+        new_value = d(i + 1);
+        d(i) = (sum + new_value) / 3.;
+        grid_total += d(i);
+      }
+      d(num_bins_ - 1) = 0.5 * (new_value + old_value);
+      grid_total += d(num_bins_ - 1);
+      // compute the rebinning weights
+      auto total_weight = 0.;
+      for (size_t i = 0; i < num_bins_; ++i) {
+        weights[i] = 0.;
+        if (d(i) > 0.) {
+          const auto ratio = grid_total / d(i);
+          weights[i] = std::pow((ratio - 1.) / ratio / std::log(ratio), alpha_);
+        }
+        total_weight += weights[i];
+      }
+      if (total_weight <= 0.)  // no information collected for this dimension
+        continue;
+      const auto points_per_bin = total_weight / num_bins_;
+      // redistribute the bin edges
+      auto x_old = 0., x_new = 0., dw = 0.;
+      size_t i = 1;
+      for (size_t k = 0; k < num_bins_; ++k) {
+        dw += weights[k];
+        x_old = x_new;
+        x_new = xi(k + 1, j);
+        for (; dw > points_per_bin && i < num_bins_; ++i) {
+          dw -= points_per_bin;
+          new_grid[i] = x_new - (x_new - x_old) * dw / weights[k];
+        }
+      }
+      for (size_t k = 1; k < num_bins_; ++k)
+        xi(k, j) = new_grid[k];
+      xi(num_bins_, j) = 1.;
+    }
+  }
+
+  const size_t num_function_calls_;
+  const size_t num_warmup_calls_;
+  const size_t num_iterations_;
+  const size_t num_bins_;
+  const double chi_square_cut_;
+  const double alpha_;
+  const bool treat_;  ///< Is the integrand to be smoothed for events generation?
+
+  double volume_{1.};                 ///< Integration volume
+  std::vector<double> grid_;          ///< Bins edges along each dimension, (numBins+1) x ndim
+  std::vector<double> distribution_;  ///< Per-bin sum of squared function values, numBins x ndim
+  std::vector<double> unit_points_;   ///< Uniformly distributed coordinates
+  std::vector<double> points_;        ///< Coordinates mapped onto the grid and integration range
+  std::vector<size_t> bins_;          ///< Grid bin indices for all coordinates
+  std::vector<double> weights_;       ///< Function values for a batch of points
+};
+REGISTER_INTEGRATOR("Vegas_mt", ParallelVegasIntegrator);
@@ -16,6 +16,7 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <atomic>
 #include <numeric>
 
 #include "CepGen/Core/Exception.h"
@@ -24,13 +25,20 @@
 #include "CepGen/EventFilter/EventBrowser.h"
 #include "CepGen/EventFilter/EventModifier.h"
 #include "CepGen/Integration/ProcessIntegrand.h"
+#include "CepGen/Modules/EventModifierFactory.h"
+#include "CepGen/Modules/FunctionalFactory.h"
 #include "CepGen/Process/Process.h"
 #include "CepGen/Utils/Functional.h"
 #include "CepGen/Utils/Math.h"
+#include "CepGen/Utils/String.h"
 #include "CepGen/Utils/TimeKeeper.h"
+#include "CepGen/Utils/Value.h"
 
 using namespace cepgen;
 
+/// Number of private event modification algorithms sequences built, used to decorrelate their random numbers streams
+static std::atomic<int> kNumLocalModulesSequences{0};
+
 ProcessIntegrand::ProcessIntegrand(const proc::Process& process)
     : run_parameters_(new RunParameters), timer_(new utils::Timer) {
   setProcess(process);
@@ -45,8 +53,19 @@ ProcessIntegrand::ProcessIntegrand(const RunParameters* run_parameters)
   setProcess(run_parameters_->process());
 }
 
+ProcessIntegrand::~ProcessIntegrand() = default;
+
 size_t ProcessIntegrand::size() const { return process().ndim(); }
 
+std::unique_ptr<Integrand> ProcessIntegrand::clone() const {
+  auto integrand = run_parameters_->hasProcess() ? std::make_unique<ProcessIntegrand>(run_parameters_)
+                                                 : std::make_unique<ProcessIntegrand>(process());
+  integrand->setStorage(storage_);
+  integrand->setDeferredModification(deferred_modification_);
+  integrand->useLocalModules();  // clones are meant to be evaluated concurrently to this integrand
+  return integrand;
+}
+
 void ProcessIntegrand::setProcess(const proc::Process& original_process) {
   process_ = original_process.clone();  // each integrand object has its own clone of the process
   // NOTE: kinematics is already set by the process copy constructor
@@ -86,6 +105,49 @@ const proc::Process& ProcessIntegrand::process() const {
   return *process_;
 }
 
+void ProcessIntegrand::setCrossSection(const Value& cross_section) {
+  cross_section_ = std::make_unique<Value>(cross_section);  // kept for the private modifiers yet to be built
+  for (const auto& event_modifier : event_modifiers_)
+    event_modifier->setCrossSection(cross_section);
+}
+
+const std::vector<std::unique_ptr<EventModifier> >& ProcessIntegrand::eventModifiers() {
+  if (!local_modules_)
+    return run_parameters_->eventModifiersSequence();
+  if (local_event_modifiers_built_)
+    return event_modifiers_;
+  const auto sequence_id = ++kNumLocalModulesSequences;
+  for (const auto& event_modifier : run_parameters_->eventModifiersSequence()) {
+    auto params = event_modifier->parameters();
+    if (params.has<int>("seed"))  // only a user-defined seed is shifted
+      if (const auto seed = params.get<int>("seed"); seed >= 0)  // a negative seed is left to the algorithm's choice
+        params.set<int>("seed", seed + sequence_id);
+    auto& modifier = event_modifiers_.emplace_back(EventModifierFactory::get().build(params));
+    // same configuration sequence as for the original algorithm (pre-initialisation, then process-specific parts)
+    modifier->readStrings(params.get<std::vector<std::string> >("preConfiguration"));
+    modifier->initialise(*run_parameters_);
+    for (const auto& block : params.get<std::vector<std::string> >("processConfiguration"))
+      modifier->readStrings(params.get<std::vector<std::string> >(block));
+    if (cross_section_)
+      modifier->setCrossSection(*cross_section_);
+  }
+  local_event_modifiers_built_ = true;
+  CG_DEBUG("ProcessIntegrand:eventModifiers")
+      << "Built private copies of " << utils::s("event modification algorithm", event_modifiers_.size(), true) << ".";
+  return event_modifiers_;
+}
+
+const std::vector<std::unique_ptr<utils::Functional> >& ProcessIntegrand::tamingFunctions() {
+  if (!local_modules_)
+    return run_parameters_->tamingFunctions();
+  if (!local_taming_functions_built_) {
+    for (const auto& taming_function : run_parameters_->tamingFunctions())
+      taming_functions_.emplace_back(FunctionalFactory::get().build(taming_function->parameters()));
+    local_taming_functions_built_ = true;
+  }
+  return taming_functions_;
+}
+
 double ProcessIntegrand::eval(const std::vector<double>& x) {
   CG_TICKER(const_cast<RunParameters*>(run_parameters_)->timeKeeper());
   timer_->reset();  // start the timer
@@ -101,18 +163,26 @@ double ProcessIntegrand::eval(const std::vector<double>& x) {
   auto* event = process_->eventPtr();  // prepare the event content
 
   // once kinematics variables computed, can apply taming functions
-  for (const auto& taming_function : run_parameters_->tamingFunctions())
-    if (const auto val = (*taming_function)(bws_.get(*event, taming_function->variables().at(0))) != 0.)
-      weight *= val;
-    else
-      return 0.;
+  if (const auto& taming_functions = tamingFunctions(); !taming_functions.empty()) {
+    if (taming_variables_.size() != taming_functions.size()) {  // variables are only parsed once
+      taming_variables_.clear();
+      for (const auto& taming_function : taming_functions)
+        taming_variables_.emplace_back(bws_.compile(taming_function->variables().at(0)));
+    }
+    for (size_t i = 0; i < taming_functions.size(); ++i)
+      if (const auto val = (*taming_functions[i])(taming_variables_[i](*event)); val != 0.)
+        weight *= val;
+      else
+        return 0.;
+  }
 
-  if (storage_)
-    event->metadata["time:generation"] = timer_->elapsed();  // pure CepGen part of the event generation
+  if (storage_)  // pure CepGen part of the event generation
+    event->metadata[Event::EventMetadata::GenerationTime] = timer_->elapsed();
 
-  {  // run all event modification algorithms
+  // run all event modification algorithms (unless deferred after the event acceptance)
+  if (!deferred_modification_ && !eventModifiers().empty()) {
     double branching_ratio = -1.;
-    for (auto& event_modifier : run_parameters_->eventModifiersSequence()) {
+    for (auto& event_modifier : eventModifiers()) {
       if (!event_modifier->run(*event, branching_ratio, !storage_) || branching_ratio == 0.)
         return 0.;
       weight *= branching_ratio;  // branching fraction for all decays
@@ -120,14 +190,16 @@ double ProcessIntegrand::eval(const std::vector<double>& x) {
   }
   const auto& kinematics = process_->kinematics();
   if (!kinematics.cuts().central.contain((*event)(Particle::Role::CentralSystem)))
-    // apply cuts on final state system (after event modification algorithms)
+    // apply cuts on final state system (after event modification algorithms, unless these are deferred)
     // (polish your cuts, as this might be very time-consuming...)
     return 0.;
   for (const auto& part : (*event)(Particle::Role::CentralSystem))
     // retrieve all cuts associated to this final state particle in the central system
-    if (kinematics.cuts().central_particles.count(part.pdgId()) > 0 &&
-        !kinematics.cuts().central_particles.at(part.pdgId()).contain({part}))
-      return 0.;
+    if (kinematics.cuts().central_particles.count(part.pdgId()) > 0) {
+      single_particle_.front() = part;  // single-particle buffer avoids a per-event allocation
+      if (!kinematics.cuts().central_particles.at(part.pdgId()).contain(single_particle_))
+        return 0.;
+    }
   if (!kinematics.incomingBeams().positive().elastic() &&
       !kinematics.cuts().remnants.contain((*event)(Particle::Role::OutgoingBeam1), event))
     return 0.;
@@ -136,15 +208,47 @@ double ProcessIntegrand::eval(const std::vector<double>& x) {
     return 0.;
 
   if (storage_) {  // add generation metadata to the event
-    event->metadata["weight"] = weight;
-    event->metadata["time:total"] = timer_->elapsed();
+    event->metadata[Event::EventMetadata::Weight] = weight;
+    event->metadata[Event::EventMetadata::TotalTime] = timer_->elapsed();
   }
 
-  CG_DEBUG_LOOP("ProcessIntegrand") << "[process " << std::hex << dynamic_cast<void*>(process_.get()) << std::dec
-                                    << "]\n\t"
-                                    << "functional value for dimension-" << x.size() << " point " << x << ": " << weight
-                                    << ".\n\t"
-                                    << "Generation time: " << event->metadata("time:generation") * 1.e3 << " ms\n\t"
-                                    << "Total time (gen+mod+cuts): " << event->metadata("time:total") * 1.e3 << " ms";
+  CG_DEBUG_LOOP("ProcessIntegrand")
+      << "[process " << std::hex << dynamic_cast<void*>(process_.get()) << std::dec << "]\n\t"
+      << "functional value for dimension-" << x.size() << " point " << x << ": " << weight << ".\n\t"
+      << "Generation time: " << event->metadata(Event::EventMetadata::GenerationTime) * 1.e3 << " ms\n\t"
+      << "Total time (gen+mod+cuts): " << event->metadata(Event::EventMetadata::TotalTime) * 1.e3 << " ms";
   return weight;
 }
+
+double ProcessIntegrand::modifyEvent(size_t num_attempts) {
+  const auto& event_modifiers = eventModifiers();
+  if (event_modifiers.empty() || !process_->hasEvent())
+    return 1.;
+  CG_TICKER(const_cast<RunParameters*>(run_parameters_)->timeKeeper());
+  auto& event = process_->event();
+  if (num_attempts > 1)
+    unmodified_event_ = event;  // keep a copy of the event content for the subsequent attempts
+  for (size_t attempt = 0; attempt < num_attempts; ++attempt) {
+    if (attempt > 0)
+      event = unmodified_event_;
+    double weight = 1., branching_ratio = -1.;
+    bool vetoed = false;
+    for (auto& event_modifier : event_modifiers) {
+      vetoed = !event_modifier->run(event, branching_ratio, !storage_) || branching_ratio == 0.;
+      if (vetoed)
+        break;
+      weight *= branching_ratio;  // branching fraction for all decays
+    }
+    if (vetoed) {
+      CG_DEBUG_LOOP("ProcessIntegrand:modifyEvent")
+          << "Event vetoed by a modification algorithm (attempt " << (attempt + 1) << "/" << num_attempts << ").";
+      continue;
+    }
+    if (storage_) {  // update the generation metadata with the modification step
+      event.metadata[Event::EventMetadata::Weight] = event.metadata(Event::EventMetadata::Weight) * weight;
+      event.metadata[Event::EventMetadata::TotalTime] = timer_->elapsed();
+    }
+    return weight;
+  }
+  return 0.;
+}
@@ -0,0 +1,47 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "CepGen/Integration/VegasGrid.h"
+
+void cepgen::vegas::treat(const double* grid,
+                          size_t num_bins,
+                          size_t ndim,
+                          const std::vector<double>& points,
+                          std::vector<double>& treated_points,
+                          std::vector<double>& jacobians) {
+  const auto num_points = ndim > 0 ? points.size() / ndim : 0;
+  treated_points.resize(num_points * ndim);
+  // the grid normalisation factor is common to all points
+  jacobians.assign(num_points, std::pow(static_cast<double>(num_bins), static_cast<double>(ndim)));
+  const auto bins = static_cast<double>(num_bins);
+  const auto max_bin = static_cast<double>(num_bins - 1);
+  const auto *in = points.data(), *edges = grid;
+  auto *out = treated_points.data(), *jac = jacobians.data();
+  for (size_t j = 0; j < ndim; ++j)  // dimension-major, so that iterations over the points are independent
+    for (size_t i = 0; i < num_points; ++i) {
+      const auto z = in[i * ndim + j] * bins;
+      const auto bin = std::min(std::floor(z), max_bin);  // also protects against coordinates at the upper edge
+      const auto k = static_cast<size_t>(bin);
+      const auto low = edges[k * ndim + j], width = edges[(k + 1) * ndim + j] - low;
+      out[i * ndim + j] = low + width * (z - bin);
+      jac[i] *= width;
+    }
+}
@@ -18,11 +18,13 @@
 
 #include <gsl/gsl_monte_vegas.h>
 
+#include <algorithm>
 #include <cmath>
 
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Integration/GSLIntegrator.h"
 #include "CepGen/Integration/Integrand.h"
+#include "CepGen/Integration/VegasGrid.h"
 #include "CepGen/Modules/IntegratorFactory.h"
 #include "CepGen/Utils/ProcessVariablesAnalyser.h"
 #include "CepGen/Utils/RandomGenerator.h"
@@ -125,6 +127,30 @@ public:
     return Value{result, absolute_error};
   }
 
+  std::vector<double> state() const override {
+    if (!vegas_state_)
+      return {};
+    std::vector<double> state{static_cast<double>(vegas_state_->dim), static_cast<double>(vegas_state_->bins)};
+    state.insert(state.end(), vegas_state_->xi, vegas_state_->xi + (vegas_state_->bins + 1) * vegas_state_->dim);
+    return state;
+  }
+  bool setState(const std::vector<double>& state) override {
+    // dimensions are checked before any conversion or allocation, so that an invalid state never alters this one
+    const auto valid_size = [&state](double value) { return value >= 1. && value < state.size(); };
+    if (state.size() < 2 || !valid_size(state.at(0)) || !valid_size(state.at(1)))
+      return false;
+    const auto dim = static_cast<size_t>(state.at(0)), bins = static_cast<size_t>(state.at(1));
+    if (bins < 2 || state.size() != 2 + (bins + 1) * dim)  // at least two bins are required for the grid remapping
+      return false;
+    std::unique_ptr<gsl_monte_vegas_state, gsl_monte_vegas_deleter> vegas_state(gsl_monte_vegas_alloc(dim));
+    if (!vegas_state || bins > vegas_state->bins_max)
+      return false;
+    vegas_state->bins = bins;
+    std::copy(state.begin() + 2, state.end(), vegas_state->xi);
+    vegas_state_ = std::move(vegas_state);
+    return true;
+  }
+
   enum class Mode { importance = 1, importanceOnly = 0, stratified = -1 };
   friend std::ostream& operator<<(std::ostream& os, const Mode& mode) {
     switch (mode) {
@@ -160,28 +186,24 @@ private:
     CG_INFO("VegasIntegrator:warmup") << "Finished the Vegas warm-up.";
   }
 
-  double COORD(size_t i, size_t j) const { return vegas_state_->xi[i * vegas_state_->dim + j]; }
-
   double eval(Integrand& integrand, const std::vector<double>& coordinates) const override {
     if (!treat_)  // by default, no grid treatment
       return integrand.eval(coordinates);
     // treatment of the integration grid
-    if (r_boxes_ == 0) {
-      r_boxes_ = static_cast<size_t>(std::pow(vegas_state_->bins, integrand.size()));
-      treated_coordinates_.resize(integrand.size());
-    }
-    double weight = r_boxes_;
-    for (size_t j = 0; j < integrand.size(); ++j) {
-      // find surrounding coordinates and interpolate
-      const double z = coordinates.at(j) * vegas_state_->bins;
-      const auto id = static_cast<size_t>(z);  // coordinate of point before
-      const double rel_pos = z - id;           // position between coordinates (norm.)
-      const double bin_width = id == 0 ? COORD(1, j) : COORD(id + 1, j) - COORD(id, j);
-      // build new coordinate from linear interpolation
-      treated_coordinates_[j] = COORD(id + 1, j) - bin_width * (1. - rel_pos);
-      weight *= bin_width;
-    }
-    return weight * integrand.eval(treated_coordinates_);
+    // (no state is modified here, as this method may be called concurrently by several generator workers)
+    thread_local std::vector<double> treated_coordinates, jacobian;
+    treat(integrand.size(), coordinates, treated_coordinates, jacobian);
+    return jacobian.at(0) * integrand.eval(treated_coordinates);
+  }
+  void treat(size_t ndim,
+             const std::vector<double>& points,
+             std::vector<double>& treated_points,
+             std::vector<double>& jacobians) const override {
+    if (!treat_)
+      return Integrator::treat(ndim, points, treated_points, jacobians);
+    if (!vegas_state_)
+      throw CG_FATAL("VegasIntegrator:treat") << "Vegas state not initialised!";
+    vegas::treat(vegas_state_->xi, vegas_state_->bins, ndim, points, treated_points, jacobians);
   }
 
   const int num_function_calls_;
@@ -196,7 +218,5 @@ private:
 
   /// A Vegas integrator state for integration (optional) and/or "treated" event generation
   std::unique_ptr<gsl_monte_vegas_state, gsl_monte_vegas_deleter> vegas_state_{nullptr};
-  mutable unsigned long long r_boxes_{0ull};
-  mutable std::vector<double> treated_coordinates_;
 };
 REGISTER_INTEGRATOR("Vegas", VegasIntegrator);
@@ -0,0 +1,53 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CepGen/Event/Event.h"
+#include "CepGen/EventFilter/EventExporter.h"
+#include "CepGen/Modules/EventExporterFactory.h"
+#include "CepGen/Utils/BinaryEventFile.h"
+#include "CepGen/Utils/Value.h"
+
+using namespace cepgen;
+using namespace std::string_literals;
+
+/// Exporter to the CepGen-native binary events format
+/// \author Laurent Forthomme <laurent.forthomme@cern.ch>
+/// \date Oct 2026
+class BinaryEventExporter final : public EventExporter {
+public:
+  explicit BinaryEventExporter(const ParametersList& params)
+      : EventExporter(params), writer_(steer<std::string>("filename"), steer<int>("chunkSize")) {}
+
+  static ParametersDescription description() {
+    auto desc = EventExporter::description();
+    desc.setDescription("CepGen-native binary events format exporter");
+    desc.add("filename", "output.cgevt"s).setDescription("Output filename");
+    desc.add("chunkSize", 1000).setDescription("number of events stored in each chunk of particles columns");
+    return desc;
+  }
+
+  void setCrossSection(const Value& cross_section) override { writer_.setCrossSection(cross_section); }
+  bool operator<<(const Event& event) override {
+    writer_.write(event);
+    return true;
+  }
+
+private:
+  utils::BinaryEventWriter writer_;
+};
+REGISTER_EXPORTER("binary", BinaryEventExporter);
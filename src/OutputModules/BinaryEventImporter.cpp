@@ -0,0 +1,57 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CepGen/Event/Event.h"
+#include "CepGen/EventFilter/EventImporter.h"
+#include "CepGen/Modules/EventImporterFactory.h"
+#include "CepGen/Utils/BinaryEventFile.h"
+
+using namespace cepgen;
+using namespace std::string_literals;
+
+/// Importer from the CepGen-native binary events format
+/// \note The underlying reader (retrieved through the engine() method) gives a random access to events views
+/// \author Laurent Forthomme <laurent.forthomme@cern.ch>
+/// \date Oct 2026
+class BinaryEventImporter final : public EventImporter {
+public:
+  explicit BinaryEventImporter(const ParametersList& params)
+      : EventImporter(params), reader_(steer<std::string>("filename")) {}
+
+  static ParametersDescription description() {
+    auto desc = EventImporter::description();
+    desc.setDescription("CepGen-native binary events format importer");
+    desc.add("filename", "output.cgevt"s).setDescription("Input filename");
+    return desc;
+  }
+
+  bool operator>>(Event& event) override {
+    if (next_event_ >= reader_.size())
+      return false;
+    reader_[next_event_++].fill(event);
+    return true;
+  }
+
+private:
+  void initialise() override { setCrossSection(reader_.crossSection()); }
+  void* enginePtr() override { return &reader_; }
+
+  utils::BinaryEventReader reader_;
+  size_t next_event_{0};
+};
+REGISTER_EVENT_IMPORTER("binary", BinaryEventImporter);
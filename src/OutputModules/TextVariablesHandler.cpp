@@ -36,7 +36,8 @@ public:
       : EventExporter(params),
         file_(steer<std::string>("filename")),
         variables_(steer<std::vector<std::string> >("variables")),
-        separator_(steer<std::string>("separator")) {}
+        separator_(steer<std::string>("separator")),
+        accessors_(utils::EventBrowser().compile(variables_)) {}
 
   static ParametersDescription description() {
     auto desc = EventExporter::description();
@@ -50,11 +51,12 @@ public:
   }
 
   bool operator<<(const Event& ev) override {
-    if (variables_.empty())
+    if (accessors_.empty())
       return true;
+    utils::EventBrowser::get(ev, accessors_, values_);
     std::string sep;
-    for (const auto& var : variables_)  // write down the variables list in the file
-      file_ << sep << browser_.get(ev, var), sep = separator_;
+    for (const auto& value : values_)  // write down the variables list in the file
+      file_ << sep << value, sep = separator_;
     file_ << "\n";
     return true;
   }
@@ -70,7 +72,7 @@ private:
   std::ofstream file_;
   const std::vector<std::string> variables_;  ///< Variables definition
   const std::string separator_;
-
-  const utils::EventBrowser browser_;
+  const std::vector<utils::EventBrowser::Accessor> accessors_;  ///< Precompiled variables accessors
+  std::vector<double> values_;                                  ///< Variables values for the current event
 };
 REGISTER_EXPORTER("vars", TextVariablesHandler);
@@ -16,7 +16,9 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cmath>
+#include <mutex>
 
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Integration/Integrator.h"
@@ -27,8 +29,11 @@
 #include "CepGen/Physics/PDG.h"
 #include "CepGen/Utils/FunctionWrapper.h"
 #include "CepGen/Utils/Limits.h"
+#include "CepGen/Utils/TableCache.h"
+#include "CepGen/Utils/UniformGrid.h"
 
 using namespace cepgen;
+using namespace std::string_literals;
 
 class KTIntegratedFlux : public CollinearFlux {
 public:
@@ -44,6 +49,12 @@ public:
                                 << "Integrator: " << integrator_->name() << "\n\t"
                                 << "Q^2 integration range: " << kt2_range_ << " GeV^2\n\t"
                                 << "Unintegrated flux: " << flux_->name() << ".";
+    if (const auto& grid_variable = steer<std::string>("gridVariable");
+        grid_variable == "Q2" || grid_variable == "MX2") {
+      use_grid_ = true;
+      grid_mx2_ = grid_variable == "MX2";
+    } else if (grid_variable != "none")
+      throw CG_FATAL("KTIntegratedFlux") << "Invalid grid variable: '" << grid_variable << "'.";
   }
 
   bool fragmenting() const final { return flux_->fragmenting(); }
@@ -59,26 +70,97 @@ public:
         .setDescription("Type of unintegrated kT-dependent parton flux");
     desc.add("kt2range", Limits{0., 1.e4})
         .setDescription("kinematic range for the parton transverse virtuality, in GeV^2");
+    desc.add("gridVariable", "none"s)
+        .allow("none", "integrate the flux for each evaluation")
+        .allow("Q2", "precompute an (x, Q^2) grid of fluxes")
+        .allow("MX2", "precompute an (x, mX^2) grid of fluxes")
+        .setDescription("second variable of the precomputed kt-integrated flux grid");
+    desc.add("gridXrange", Limits{1.e-6, 1.}).setDescription("parton momentum fraction range covered by the grid");
+    desc.add("gridVirtualityRange", Limits{1.e-8, 1.e4})
+        .setDescription("virtuality (Q^2 or mX^2) range covered by the grid, in GeV^2");
+    desc.add("gridNumX", 200).setDescription("number of log(x) nodes in the grid");
+    desc.add("gridNumVirtuality", 200).setDescription("number of log(virtuality) nodes in the grid");
+    desc += Grid::cachingDescription(25, 1.e-3);
     return desc;
   }
 
   double fluxQ2(double x, double q2) const override {
     if (!x_range_.contains(x, true))
       return 0.;
-    return 2. * M_PI *
-           integrator_->integrate([this, &x, &q2](double kt2) { return flux_->fluxQ2(x, kt2, q2); }, kt2_range_);
+    if (const auto* grid = this->grid(); grid && !grid_mx2_ && grid->contains({x, q2}))
+      return std::max(grid->eval({x, q2})[0], 0.);  // cubic interpolation may undershoot next to kinematic thresholds
+    return integrate(*flux_, *integrator_, false, x, q2);
   }
 
   double fluxMX2(double x, double mx2) const override {
     if (!x_range_.contains(x, true))
       return 0.;
-    return 2. * M_PI *
-           integrator_->integrate([this, &x, &mx2](double kt2) { return flux_->fluxMX2(x, kt2, mx2); }, kt2_range_);
+    if (const auto* grid = this->grid(); grid && grid_mx2_ && grid->contains({x, mx2}))
+      return std::max(grid->eval({x, mx2})[0], 0.);  // cubic interpolation may undershoot next to kinematic thresholds
+    return integrate(*flux_, *integrator_, true, x, mx2);
   }
 
 private:
+  using Grid = UniformGrid<2, 1>;
+  /// Integrate the unintegrated flux over the parton transverse virtuality range
+  double integrate(const KTFlux& flux, Integrator& integrator, bool use_mx2, double x, double virtuality) const {
+    if (use_mx2)
+      return 2. * M_PI *
+             integrator.integrate([&flux, &x, &virtuality](double kt2) { return flux.fluxMX2(x, kt2, virtuality); },
+                                  kt2_range_);
+    return 2. * M_PI *
+           integrator.integrate([&flux, &x, &virtuality](double kt2) { return flux.fluxQ2(x, kt2, virtuality); },
+                                kt2_range_);
+  }
+  /// Grid of kt-integrated fluxes, shared by all instances with the same configuration, and built at its first use
+  const Grid* grid() const {
+    if (!use_grid_)
+      return nullptr;
+    std::call_once(grid_retrieved_, [this]() {
+      grid_ = utils::TableCache::shared<Grid>("ktintflux", gridConfiguration(), [this]() { return buildGrid(); });
+    });
+    return grid_.get();
+  }
+  /// Serialised configuration of the kt-integrated fluxes grid
+  std::string gridConfiguration() const {
+    return ParametersList()
+        .set("ktFlux", flux_->parameters())
+        .set("integrator", integrator_->parameters())
+        .set("kt2range", kt2_range_)
+        .set("gridVariable", steer<std::string>("gridVariable"))
+        .set("gridXrange", steer<Limits>("gridXrange"))
+        .set("gridVirtualityRange", steer<Limits>("gridVirtualityRange"))
+        .set("gridNumX", steer<int>("gridNumX"))
+        .set("gridNumVirtuality", steer<int>("gridNumVirtuality"))
+        .serialise();
+  }
+  /// Fill (or retrieve from the cache) the kt-integrated fluxes grid
+  std::unique_ptr<Grid> buildGrid() const {
+    auto grid = std::make_unique<Grid>(
+        std::array<Limits, 2>{steer<Limits>("gridXrange"), steer<Limits>("gridVirtualityRange")},
+        std::array<size_t, 2>{static_cast<size_t>(steer<int>("gridNumX")),
+                              static_cast<size_t>(steer<int>("gridNumVirtuality"))});
+    // the unintegrated flux and integrator objects are stateful, hence each thread builds its own copies
+    grid->buildCached(
+        "ktintflux",
+        gridConfiguration(),
+        [this]() -> Grid::Function {
+          const std::shared_ptr<KTFlux> flux(KTFluxFactory::get().build(flux_->parameters()));
+          const std::shared_ptr<Integrator> integrator(IntegratorFactory::get().build(integrator_->parameters()));
+          return [this, flux, integrator](const auto& coord) -> Grid::values_t {
+            return {integrate(*flux, *integrator, grid_mx2_, coord.at(0), coord.at(1))};
+          };
+        },
+        parameters());
+    return grid;
+  }
+
   const std::unique_ptr<Integrator> integrator_;
   const std::unique_ptr<KTFlux> flux_;
   const Limits kt2_range_;
+  bool use_grid_{false};                      ///< Are the fluxes interpolated from a precomputed grid?
+  bool grid_mx2_{false};                      ///< Is the grid second variable the remnant mass (or the virtuality)?
+  mutable std::shared_ptr<const Grid> grid_;  ///< Optional grid of precomputed kt-integrated fluxes
+  mutable std::once_flag grid_retrieved_;     ///< Has the grid been retrieved (or built) already?
 };
 REGISTER_COLLINEAR_FLUX("KTIntegrated", KTIntegratedFlux);
@@ -16,6 +16,8 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <mutex>
+
 #include "CepGen/Modules/CouplingFactory.h"
 #include "CepGen/Physics/Coupling.h"
 #include "CepGen/Physics/PDG.h"
@@ -58,12 +60,17 @@ public:
     return desc;
   }
 
-  double operator()(double q) const override { return alphas_(q); }
+  double operator()(double q) const override {
+    const std::lock_guard<std::mutex> lock(mutex_);  // evolution tables are stored in global Fortran common blocks
+    return alphas_(q);
+  }
 
 private:
   int order_;
   double fr2_;
   double mu_;
   double alphas_mu_;
+  static std::mutex mutex_;  ///< Serialisation of the (non-reentrant) PEGASUS evaluations
 };
+std::mutex AlphaSPEGASUS::mutex_;
 REGISTER_ALPHAS_MODULE("pegasus", AlphaSPEGASUS);
@@ -37,7 +37,9 @@ GluonGrid::GluonGrid(const cepgen::ParametersList& params)
   CG_INFO("GluonGrid") << "Building the KMR grid evaluator.";
 
   cepgen::utils::Timer tmr;
-  {  // file readout part
+  if (isBinaryGrid(grid_path_))  // pre-indexed grid file
+    load(grid_path_);
+  else {  // file readout part
     std::ifstream file(grid_path_, std::ios::in);
     if (!file.is_open())
       throw CG_FATAL("GluonGrid") << "Failed to load grid file \"" << grid_path_ << "\"!";
@@ -48,6 +50,10 @@ GluonGrid::GluonGrid(const cepgen::ParametersList& params)
     file.close();
     initialise();  // initialise the grid after filling its nodes
   }
+  if (const auto& output_path = steer<std::string>("binaryOutput"); !output_path.empty()) {
+    save(output_path, grid_path_);
+    CG_INFO("GluonGrid") << "KMR grid stored in binary grid file \"" << output_path << "\".";
+  }
   const auto limits = boundaries();
   CG_INFO("GluonGrid") << "KMR grid evaluator built in " << tmr.elapsed() << " s.\n\t"
                        << " log(x)    in range " << limits.at(0) << ",\t"
@@ -64,6 +70,9 @@ double GluonGrid::operator()(double x, double kt2, double mu2) const {
 
 cepgen::ParametersDescription GluonGrid::description() {
   auto desc = cepgen::ParametersDescription();
-  desc.addAs<std::string>("path", DEFAULT_KMR_GRID_PATH);
+  desc.addAs<std::string>("path", DEFAULT_KMR_GRID_PATH)
+      .setDescription("Path to the KMR grid content (original or pre-indexed binary format)");
+  desc.add("binaryOutput", std::string())
+      .setDescription("If set, path to the pre-indexed binary grid file to be produced");
   return desc;
 }
@@ -132,8 +132,8 @@ void FactorisedProcess::fillKinematics() {
   }
   if (store_alphas_) {  // add couplings to metadata
     const auto two_parton_mass = (q1() + q2()).mass();
-    event().metadata["alphaEM"] = alphaEM(two_parton_mass);
-    event().metadata["alphaS"] = alphaS(two_parton_mass);
+    event().metadata[Event::EventMetadata::AlphaEM] = alphaEM(two_parton_mass);
+    event().metadata[Event::EventMetadata::AlphaS] = alphaS(two_parton_mass);
   }
 }
 
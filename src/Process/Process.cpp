@@ -110,17 +110,19 @@ Momentum& Process::q2() { return event().oneWithRole(Particle::Role::Parton2).mo
 const Momentum& Process::q2() const { return event().oneWithRole(Particle::Role::Parton2).momentum(); }
 
 Momentum& Process::pc(size_t i) {
-  if (event()[Particle::Role::CentralSystem].size() <= i)
+  auto& central_particles = event().map()[Particle::Role::CentralSystem];
+  if (central_particles.size() <= i)
     throw CG_FATAL("Process:pc") << "Trying to retrieve central particle #" << i << " while only "
-                                 << event()[Particle::Role::CentralSystem].size() << " is/are registered.";
-  return event()[Particle::Role::CentralSystem].at(i).get().momentum();
+                                 << central_particles.size() << " is/are registered.";
+  return central_particles[i].momentum();
 }
 
 const Momentum& Process::pc(size_t i) const {
-  if (event()(Particle::Role::CentralSystem).size() <= i)
+  const auto& central_particles = event()(Particle::Role::CentralSystem);
+  if (central_particles.size() <= i)
     throw CG_FATAL("Process:pc") << "Trying to retrieve central particle #" << i << " while only "
-                                 << event()(Particle::Role::CentralSystem).size() << " is/are registered.";
-  return event()(Particle::Role::CentralSystem).at(i).momentum();
+                                 << central_particles.size() << " is/are registered.";
+  return central_particles[i].momentum();
 }
 
 double Process::shat() const { return (q1() + q2()).mass2(); }
@@ -44,9 +44,9 @@ namespace cepgen::strfun {
       return desc;
     }
 
-    void eval() override;
-
   private:
+    Values compute(const Arguments&) const override;
+
     class Trajectory : public SteeredObject<Trajectory> {
     public:
       explicit Trajectory(const ParametersList& params)
@@ -126,21 +126,24 @@ namespace cepgen::strfun {
                      << " q_0^2=" << q02_ << ", Lambda^2=" << lambda2_ << " GeV^2.";
   }
 
-  void ALLM::eval() {
-    const double w2_eff = utils::mX2(args_.xbj, args_.q2, mp2_) - mp2_;
-    const double xp = (args_.q2 + mpom2_) / (args_.q2 + w2_eff + mpom2_),
-                 xr = (args_.q2 + mreg2_) / (args_.q2 + w2_eff + mreg2_);
+  ALLM::Values ALLM::compute(const Arguments& args) const {
+    const double w2_eff = utils::mX2(args.xbj, args.q2, mp2_) - mp2_;
+    const double xp = (args.q2 + mpom2_) / (args.q2 + w2_eff + mpom2_),
+                 xr = (args.q2 + mreg2_) / (args.q2 + w2_eff + mreg2_);
 
-    const double xlog1 = log((args_.q2 + q02_) / lambda2_), xlog2 = log(q02_ / lambda2_);
+    const double xlog1 = log((args.q2 + q02_) / lambda2_), xlog2 = log(q02_ / lambda2_);
     const double t = log(xlog1 / xlog2);
 
     const double apom = pomeron_.eval1('a', t), bpom = pomeron_.eval2('b', t), cpom = pomeron_.eval1('c', t);
     const double areg = reggeon_.eval2('a', t), breg = reggeon_.eval2('b', t), creg = reggeon_.eval2('c', t);
 
-    const double F2_Pom = cpom * pow(xp, apom) * pow(1. - args_.xbj, bpom),
-                 F2_Reg = creg * pow(xr, areg) * pow(1. - args_.xbj, breg);
+    const double F2_Pom = cpom * pow(xp, apom) * pow(1. - args.xbj, bpom),
+                 F2_Reg = creg * pow(xr, areg) * pow(1. - args.xbj, breg);
 
-    setF2(args_.q2 / (args_.q2 + m02_) * (F2_Pom + F2_Reg));
+    Values vals;
+    vals.f2 = args.q2 / (args.q2 + m02_) * (F2_Pom + F2_Reg);
+    vals.fl = flFromF2(args, vals.f2);
+    return vals;
   }
 
   //---------------------------------------------------------------------------------------------
@@ -54,39 +54,39 @@ namespace cepgen::strfun {
 
     static ParametersDescription description();
 
-    void eval() override {
-      const double w2 = utils::mX2(args_.xbj, args_.q2, mp2_);
+  private:
+    Values compute(const Arguments& args) const override {
+      const double w2 = utils::mX2(args.xbj, args.q2, mp2_);
       if (w2 < mx2_min_)
-        return;
+        return Values{};
 
       //-----------------------------
       // modification of Christy-Bosted at large q2 as described in the LUXqed paper
       //-----------------------------
-      const double delq2 = args_.q2 - q20_;
+      const double delq2 = args.q2 - q20_;
       //------------------------------
 
-      double q2_eff = args_.q2, w2_eff = w2;
-      if (args_.q2 > q20_) {
+      double q2_eff = args.q2, w2_eff = w2;
+      if (args.q2 > q20_) {
         q2_eff = q20_ + delq2 / (1. + delq2 / (q21_ - q20_));
-        w2_eff = utils::mX2(args_.xbj, q2_eff, mp2_);
+        w2_eff = utils::mX2(args.xbj, q2_eff, mp2_);
       }
       const double sigT = resmod507(transverse, w2_eff, q2_eff);
       const double sigL = resmod507(longitudinal, w2_eff, q2_eff);
 
-      double f2 = prefactor_ * (1. - args_.xbj) * q2_eff / gamma2(args_.xbj, q2_eff) * (sigT + sigL) /
+      double f2 = prefactor_ * (1. - args.xbj) * q2_eff / gamma2(args.xbj, q2_eff) * (sigT + sigL) /
                   constants::GEVM2_TO_PB * 1.e6;
-      if (args_.q2 > q20_)
+      if (args.q2 > q20_)
         f2 *= q21_ / (q21_ + delq2);
-      setF2(f2);
-
-      if (sigT != 0.)
-        Parameterisation::computeFL(args_.xbj, q2_eff, sigL / sigT);
+      Values vals;
+      vals.f2 = f2;
+      if (sigT != 0.) {  // FL is computed from the L/T cross sections ratio of the model itself
+        const auto r = sigL / sigT;
+        vals.fl = f2 * gamma2(args.xbj, q2_eff) * (r / (1. + r));
+      }
+      return vals;
     }
-    //--- already computed internally during F2 computation
-    ChristyBosted& computeFL(double, double) override { return *this; }
-    ChristyBosted& computeFL(double, double, double) override { return *this; }
 
-  private:
     enum Polarisation { longitudinal, transverse };
     static constexpr double prefactor_ = 0.25 * M_1_PI * M_1_PI / constants::ALPHA_EM;
 
@@ -17,6 +17,7 @@
  */
 
 #include <cmath>
+#include <cstring>
 #include <fstream>
 
 #include "CepGen/Core/Exception.h"
@@ -35,8 +36,12 @@ namespace mstw {
   public:
     explicit Grid(const cepgen::ParametersList& params)
         : Parameterisation(params), GridHandler(cepgen::GridType::logarithmic) {
-      {  // file readout part
-        const auto& grid_path = steerPath("gridPath");
+      if (const auto& grid_path = steerPath("gridPath"); isBinaryGrid(grid_path)) {  // pre-indexed grid file
+        const auto metadata = load(grid_path);
+        if (metadata.size() != sizeof(header_t))
+          throw CG_FATAL("MSTW") << "Invalid MSTW header retrieved from binary grid file \"" << grid_path << "\".";
+        std::memcpy(&header_, metadata.data(), sizeof(header_t));
+      } else {  // file readout part
         std::ifstream file(grid_path, std::ios::binary | std::ios::in);
         if (!file.is_open())
           throw CG_FATAL("MSTW") << "Failed to load grid file \"" << grid_path << "\"!";
@@ -57,6 +62,10 @@ namespace mstw {
         file.close();
         initialise();  // initialise the grid after filling its nodes
       }
+      if (const auto& output_path = steer<std::string>("binaryOutput"); !output_path.empty()) {
+        save(output_path, std::string(reinterpret_cast<const char*>(&header_), sizeof(header_t)));
+        CG_INFO("MSTW") << "MSTW grid stored in binary grid file \"" << output_path << "\".";
+      }
       const auto& bounds = boundaries();
       CG_DEBUG("MSTW") << "MSTW@" << header_.order << " grid evaluator built "
                        << "for " << header_.nucleon << " structure functions (" << header_.cl << ")\n\t"
@@ -68,7 +77,9 @@ namespace mstw {
     static cepgen::ParametersDescription description() {
       auto desc = Parameterisation::description();
       desc.setDescription("MSTW grid (perturbative)");
-      desc.add("gridPath", "mstw_sf_scan_nnlo.dat"s).setDescription("Path to the MSTW grid content");
+      desc.add("gridPath", "mstw_sf_scan_nnlo.dat"s)
+          .setDescription("Path to the MSTW grid content (original or pre-indexed binary format)");
+      desc.add("binaryOutput", ""s).setDescription("If set, path to the pre-indexed binary grid file to be produced");
       return desc;
     }
 
@@ -88,18 +99,17 @@ namespace mstw {
     };
 
     /// Compute the structure functions at a given \f$Q^2/x_{\rm Bj}\f$
-    void eval() override {
-      const auto& val = GridHandler::eval({args_.xbj, args_.q2});
-      setF2(val.at(0));
-      setFL(val.at(1));
+    Values compute(const Arguments& args) const override {
+      accel_t accelerators{};  // caller-owned accelerators for a reentrant grid evaluation
+      const auto& val = GridHandler::eval({args.xbj, args.q2}, accelerators);
+      Values vals;
+      vals.f2 = val.at(0);
+      vals.fl = val.at(1);
+      return vals;
     }
     /// Retrieve the grid's header information
     header_t header() const { return header_; }
 
-    //--- already retrieved from grid, so no need to recompute it
-    Grid& computeFL(double, double) override { return *this; }
-    Grid& computeFL(double, double, double) override { return *this; }
-
   private:
     static constexpr unsigned int GOOD_MAGIC = 0x5754534d;  // MSTW in ASCII
 
@@ -51,6 +51,50 @@ Parameterisation& Parameterisation::operator()(double xbj, double q2) {
   return *this;
 }
 
+Parameterisation::Values Parameterisation::evaluate(const Arguments& args) const {
+  if (!args.valid()) {
+    CG_WARNING("StructureFunctions") << "Invalid range for Q² = " << args.q2 << " or xBj = " << args.xbj << ".";
+    return Values{};
+  }
+  auto vals = compute(args);
+  if (!hasW1W2()) {  // same definitions as for the stateful W1/W2 accessors
+    double r_error;
+    const auto r_ratio = (*r_ratio_)(args.xbj, args.q2, r_error), nu_value = nu(args.xbj, args.q2);
+    vals.w1 = vals.f2 / args.q2 / nu_value * inv_mp_ * (args.q2 + nu_value * nu_value) / (1. + r_ratio);
+    vals.w2 = vals.f2 / nu_value;
+  }
+  return vals;
+}
+
+void Parameterisation::eval() {
+  if (in_eval_)
+    throw CG_FATAL("strfun:Parameterisation") << "Structure functions parameterisation '" << name()
+                                              << "' implements neither a stateful nor a stateless evaluation method.";
+  vals_ = compute(args_);
+  fl_computed_ = true;
+}
+
+Parameterisation::Values Parameterisation::compute(const Arguments& args) const {
+  const std::lock_guard<std::mutex> lock(eval_mutex_);
+  auto& self = const_cast<Parameterisation&>(*this);  // stateful evaluation, hence its serialisation
+  self.in_eval_ = true;
+  self.clear();
+  self.args_ = args;
+  self.eval();
+  self.in_eval_ = false;
+  if (!fl_computed_)
+    self.computeFL(args.xbj, args.q2);
+  return vals_;
+}
+
+double Parameterisation::flFromF2(const Arguments& args, double f2) const {
+  if (!r_ratio_)
+    throw CG_FATAL("StructureFunctions:FL") << "Failed to retrieve a R-ratio calculator!";
+  double r_error;  // so far, nothing is done with the error propagation
+  const auto r = (*r_ratio_)(args.xbj, args.q2, r_error);
+  return f2 * gamma2(args.xbj, args.q2) * (r / (1. + r));
+}
+
 Parameterisation& Parameterisation::clear() {
   vals_.clear();
   fl_computed_ = false;
@@ -66,33 +66,36 @@ namespace cepgen::strfun {
       return desc;
     }
 
-    void eval() override {
-      const double w2 = utils::mX2(args_.xbj, args_.q2, mp2_);
-
-      if (args_.q2 < q2_cut_) {
-        if (w2 < w2_lim_.at(0)) {
-          setF2(resonances_model_->F2(args_.xbj, args_.q2));
-          setFL(resonances_model_->FL(args_.xbj, args_.q2));
-        } else if (w2 < w2_lim_.at(1)) {
+  private:
+    Values compute(const Arguments& args) const override {
+      const double w2 = utils::mX2(args.xbj, args.q2, mp2_);
+      Values vals;
+      if (args.q2 < q2_cut_) {
+        if (w2 < w2_lim_.at(0))
+          setF2FL(vals, computeFrom(*resonances_model_, args));
+        else if (w2 < w2_lim_.at(1)) {
           const double r = rho(w2);
-          setF2(r * continuum_model_->F2(args_.xbj, args_.q2) + (1. - r) * resonances_model_->F2(args_.xbj, args_.q2));
-          setFL(r * continuum_model_->FL(args_.xbj, args_.q2) + (1. - r) * resonances_model_->FL(args_.xbj, args_.q2));
-        } else {
-          setF2(continuum_model_->F2(args_.xbj, args_.q2));
-          setFL(continuum_model_->FL(args_.xbj, args_.q2));
-        }
+          const auto cont_vals = computeFrom(*continuum_model_, args), res_vals = computeFrom(*resonances_model_, args);
+          vals.f2 = r * cont_vals.f2 + (1. - r) * res_vals.f2;
+          vals.fl = r * cont_vals.fl + (1. - r) * res_vals.fl;
+        } else
+          setF2FL(vals, computeFrom(*continuum_model_, args));
       } else {
-        if (w2 < w2_lim_.at(1)) {
-          setF2(continuum_model_->F2(args_.xbj, args_.q2));
-          setFL(continuum_model_->FL(args_.xbj, args_.q2));
-        } else {
-          setF2(perturbative_model_->F2(args_.xbj, args_.q2));
-          setFL(perturbative_model_->FL(args_.xbj, args_.q2) * (1. + higher_twist_ / args_.q2));
+        if (w2 < w2_lim_.at(1))
+          setF2FL(vals, computeFrom(*continuum_model_, args));
+        else {
+          setF2FL(vals, computeFrom(*perturbative_model_, args));
+          vals.fl *= 1. + higher_twist_ / args.q2;
         }
       }
+      return vals;
+    }
+    /// Only retrieve the F2 and FL values of a sub-modelling
+    static inline void setF2FL(Values& vals, const Values& model_vals) {
+      vals.f2 = model_vals.f2;
+      vals.fl = model_vals.fl;
     }
 
-  private:
     inline double rho(double w2) const {
       const double omega = (w2 - w2_lim_.at(0)) * inv_omega_range_;
       const double omega2 = omega * omega;
@@ -0,0 +1,93 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Modules/StructureFunctionsFactory.h"
+#include "CepGen/StructureFunctions/Parameterisation.h"
+#include "CepGen/Utils/UniformGrid.h"
+
+namespace cepgen::strfun {
+  /// Tabulated version of any structure functions parameterisation, for a fast bicubic interpolation
+  class Tabulated final : public Parameterisation {
+  public:
+    explicit Tabulated(const ParametersList& params)
+        : Parameterisation(params),
+          sf_(StructureFunctionsFactory::get().build(steer<ParametersList>("structureFunctions"))),
+          grid_({steer<Limits>("xbjRange"), steer<Limits>("Q2range")},
+                {static_cast<size_t>(steer<int>("numXbj")), static_cast<size_t>(steer<int>("numQ2"))},
+                GridType::logarithmic) {
+      // the original parameterisation may be stateful, hence each thread builds its own copy
+      grid_.buildCached(
+          "strfun",
+          ParametersList()
+              .set("structureFunctions", sf_->parameters())
+              .set("xbjRange", grid_.ranges().at(0))
+              .set("Q2range", grid_.ranges().at(1))
+              .set("numXbj", steer<int>("numXbj"))
+              .set("numQ2", steer<int>("numQ2"))
+              .serialise(),
+          [this]() -> UniformGrid<2, 4>::Function {
+            const std::shared_ptr<Parameterisation> sf(StructureFunctionsFactory::get().build(sf_->parameters()));
+            return [sf](const auto& node) { return computeOriginal(*sf, node.at(0), node.at(1)); };
+          },
+          parameters(),
+          {0, 0, 2, 3});  // FL deviations are normalised to F2, as FL may vanish
+    }
+
+    static ParametersDescription description() {
+      auto desc = Parameterisation::description();
+      desc.setDescription("Tabulated structure functions");
+      desc.add("structureFunctions", StructureFunctionsFactory::get().describeParameters("LUXLike"))
+          .setDescription("structure functions parameterisation to tabulate");
+      desc.add("xbjRange", Limits{1.e-6, 0.999}).setDescription("Bjorken-x range covered by the table");
+      desc.add("Q2range", Limits{1.e-3, 1.e4}).setDescription("Q^2 range covered by the table (in GeV^2)");
+      desc.add("numXbj", 400).setDescription("number of log-spaced nodes along the Bjorken-x axis");
+      desc.add("numQ2", 200).setDescription("number of log-spaced nodes along the Q^2 axis");
+      desc += UniformGrid<2, 4>::cachingDescription(1000, 1.e-2);
+      return desc;
+    }
+
+    bool hasW1W2() const override { return true; }  // all quantities are tabulated
+
+  private:
+    Values compute(const Arguments& args) const override {
+      if (!grid_.contains({args.xbj, args.q2}))
+        return sf_->evaluate(args);  // outside the table, the original modelling is used
+      const auto table_vals = grid_.eval({args.xbj, args.q2});
+      // the cubic interpolation may undershoot next to the W threshold, where all quantities drop to zero
+      Values vals;
+      vals.f2 = std::max(table_vals[0], 0.);
+      vals.fl = std::max(table_vals[1], 0.);
+      vals.w1 = std::max(table_vals[2], 0.);
+      vals.w2 = std::max(table_vals[3], 0.);
+      return vals;
+    }
+    /// Compute all tabulated quantities (F2, FL, W1, and W2) from an original parameterisation
+    static UniformGrid<2, 4>::values_t computeOriginal(const Parameterisation& sf, double xbj, double q2) {
+      const auto vals = sf.evaluate({xbj, q2});
+      return {vals.f2, vals.fl, vals.w1, vals.w2};
+    }
+
+    const std::unique_ptr<Parameterisation> sf_;  ///< Original parameterisation
+    UniformGrid<2, 4> grid_;                      ///< (xbj, Q^2) table of F2, FL, W1, and W2 values
+  };
+}  // namespace cepgen::strfun
+using cepgen::strfun::Tabulated;
+REGISTER_STRFUN("Tabulated", 501, Tabulated);
@@ -0,0 +1,122 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Utils/AliasTable.h"
+#include "CepGen/Utils/RandomGenerator.h"
+
+using namespace cepgen::utils;
+
+AliasTable::AliasTable(const std::vector<double>& weights) { build(weights); }
+
+void AliasTable::build(const std::vector<double>& weights) {
+  if (weights.empty())
+    throw CG_FATAL("AliasTable:build") << "Cannot build an alias table from an empty weights collection.";
+  for (const auto& weight : weights)
+    if (weight < 0. || !std::isfinite(weight))
+      throw CG_FATAL("AliasTable:build") << "Invalid weight for alias table: " << weight << ".";
+  weights_ = weights;
+  rebuild();
+}
+
+void AliasTable::rebuild() {
+  const auto num_entries = weights_.size();
+  table_total_ = 0.;
+  for (const auto& weight : weights_)
+    table_total_ += weight;
+  residual_indices_.clear();
+  residual_cumulative_.clear();
+  residual_total_ = 0.;
+  probability_.assign(num_entries, 1.);
+  alias_.resize(num_entries);
+  for (size_t i = 0; i < num_entries; ++i)
+    alias_[i] = i;
+  if (table_total_ <= 0.)  // null distribution; fall back to a uniform sampling
+    return;
+
+  // Vose's algorithm: pair each under-populated entry with an over-populated one
+  std::vector<double> scaled(num_entries);
+  std::vector<size_t> small, large;
+  const auto norm = num_entries / table_total_;
+  for (size_t i = 0; i < num_entries; ++i) {
+    scaled[i] = weights_[i] * norm;
+    (scaled[i] < 1. ? small : large).emplace_back(i);
+  }
+  while (!small.empty() && !large.empty()) {
+    const auto less = small.back(), more = large.back();
+    small.pop_back();
+    probability_[less] = scaled[less];
+    alias_[less] = more;
+    scaled[more] += scaled[less] - 1.;
+    if (scaled[more] < 1.) {
+      large.pop_back();
+      small.emplace_back(more);
+    }
+  }
+  // remaining entries (up to rounding errors) are always accepted
+  for (const auto& index : small)
+    probability_[index] = 1.;
+  for (const auto& index : large)
+    probability_[index] = 1.;
+}
+
+void AliasTable::update(size_t index, double weight) {
+  if (index >= weights_.size())
+    throw CG_FATAL("AliasTable:update") << "Invalid entry index: " << index << " >= " << weights_.size() << ".";
+  if (weight < 0. || !std::isfinite(weight))
+    throw CG_FATAL("AliasTable:update") << "Invalid weight for alias table: " << weight << ".";
+  const auto increase = weight - weights_[index];
+  weights_[index] = weight;
+  if (increase == 0.)
+    return;
+  if (increase < 0. || table_total_ <= 0.) {  // weight decreases cannot be encoded as residuals
+    rebuild();
+    return;
+  }
+  residual_total_ += increase;
+  residual_indices_.emplace_back(index);
+  residual_cumulative_.emplace_back(residual_total_);
+  // keep the residual table small enough for its sampling to remain cheap
+  if (residual_indices_.size() > std::max<size_t>(16, std::sqrt(weights_.size())) ||
+      residual_total_ > 0.1 * table_total_)
+    rebuild();
+}
+
+double AliasTable::probability(size_t index) const {
+  const auto norm = total();
+  return norm > 0. ? weight(index) / norm : 1. / size();
+}
+
+size_t AliasTable::sample(RandomGenerator& rng) const {
+  if (weights_.empty())
+    throw CG_FATAL("AliasTable:sample") << "Alias table was not built.";
+  if (residual_total_ > 0.) {  // first select between the alias and the residual tables
+    if (const auto value = rng.uniform(0., total()); value >= table_total_) {
+      const auto it =
+          std::upper_bound(residual_cumulative_.begin(), residual_cumulative_.end(), value - table_total_);
+      return residual_indices_[std::min<size_t>(it - residual_cumulative_.begin(), residual_indices_.size() - 1)];
+    }
+  }
+  // a single uniform draw provides both the table column and the acceptance test
+  const auto value = rng.uniform(0., probability_.size());
+  const auto column = std::min<size_t>(value, probability_.size() - 1);
+  return value - column < probability_[column] ? column : alias_[column];
+}
@@ -0,0 +1,308 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Utils/BinaryEventFile.h"
+#include "CepGen/Utils/MappedFile.h"
+
+using namespace cepgen::utils;
+
+namespace {
+  /// Binary events file layout (native endianness), all blocks aligned on 8 bytes:
+  /// - header (magic, format version, flags, position of the index, and number of events),
+  /// - chunks of events, each with a chunk header followed by the particles columns (four-momenta, PDG identifiers,
+  ///   roles, statuses, events and mothers offsets, mothers indices), the metadata columns (events offsets, keys,
+  ///   values), and the list of null-terminated metadata keys names,
+  /// - index (cross-section, number of chunks, position and first event index of each chunk).
+  constexpr char kBinaryEventsMagic[8] = {'C', 'G', 'E', 'V', 'T', 'S', '0', '1'};
+  constexpr uint32_t kBinaryEventsVersion = 1;
+  struct BinaryEventsHeader {
+    char magic[8];
+    uint32_t version, flags;  // flags are reserved for future (e.g. compressed) chunks layouts
+    uint64_t index_offset, num_events;
+  };
+  static_assert(sizeof(BinaryEventsHeader) == 32, "Unexpected binary events header padding.");
+  struct BinaryEventsChunkHeader {
+    uint32_t num_events, num_particles, num_mothers, num_metadata, num_keys, keys_size;
+  };
+  static_assert(sizeof(BinaryEventsChunkHeader) == 24, "Unexpected binary events chunk header padding.");
+  struct BinaryEventsIndex {
+    double cross_section, cross_section_uncertainty;
+    uint64_t num_chunks;
+  };
+  static_assert(sizeof(BinaryEventsIndex) == 24, "Unexpected binary events index padding.");
+  constexpr size_t padding(size_t size) { return (8 - size % 8) % 8; }
+}  // namespace
+
+//----- reader
+
+BinaryEventReader::BinaryEventReader(const std::string& path) : mapping_(std::make_shared<const MappedFile>(path)) {
+  size_t offset = 0;
+  const auto read = [this, &path, &offset](size_t size) {  // retrieve a block of the file, and check its boundaries
+    if (offset > mapping_->size() || size > mapping_->size() - offset)  // no wrap-around of untrusted sizes
+      throw CG_FATAL("BinaryEventReader") << "Binary events file '" << path << "' is truncated.";
+    const auto* ptr = mapping_->data() + offset;
+    offset += size;
+    return ptr;
+  };
+  BinaryEventsHeader header;
+  std::memcpy(&header, read(sizeof(BinaryEventsHeader)), sizeof(BinaryEventsHeader));
+  if (std::memcmp(header.magic, kBinaryEventsMagic, sizeof(kBinaryEventsMagic)) != 0)
+    throw CG_FATAL("BinaryEventReader") << "File '" << path << "' is not a binary events file.";
+  if (header.version != kBinaryEventsVersion || header.flags != 0)
+    throw CG_FATAL("BinaryEventReader") << "Binary events file '" << path << "' has an unsupported format (version "
+                                        << header.version << ", flags " << header.flags << ").";
+  if (header.index_offset == 0)
+    throw CG_FATAL("BinaryEventReader") << "Binary events file '" << path << "' was not properly closed.";
+  num_events_ = header.num_events;
+
+  const auto corrupted = [&path](const std::string& what) {
+    throw CG_FATAL("BinaryEventReader") << "Binary events file '" << path << "' is corrupted: " << what << ".";
+  };
+  if (header.index_offset % 8 != 0)
+    corrupted("misaligned index");
+  offset = header.index_offset;
+  BinaryEventsIndex index;
+  std::memcpy(&index, read(sizeof(BinaryEventsIndex)), sizeof(BinaryEventsIndex));
+  cross_section_ = Value{index.cross_section, index.cross_section_uncertainty};
+  if (index.num_chunks > mapping_->size() / (2 * sizeof(uint64_t)))
+    throw CG_FATAL("BinaryEventReader") << "Binary events file '" << path << "' is truncated.";
+  const auto* chunk_offsets = reinterpret_cast<const uint64_t*>(read(index.num_chunks * sizeof(uint64_t)));
+  const auto* chunk_first_events = reinterpret_cast<const uint64_t*>(read(index.num_chunks * sizeof(uint64_t)));
+
+  chunks_.resize(index.num_chunks);
+  size_t num_chunk_events = 0;
+  for (size_t i = 0; i < index.num_chunks; ++i) {
+    auto& chunk = chunks_[i];
+    if (chunk_offsets[i] % 8 != 0)  // all columns are read in place, and must be aligned
+      corrupted("misaligned chunk " + std::to_string(i));
+    offset = chunk_offsets[i];
+    BinaryEventsChunkHeader chunk_header;
+    std::memcpy(&chunk_header, read(sizeof(BinaryEventsChunkHeader)), sizeof(BinaryEventsChunkHeader));
+    chunk.first_event = chunk_first_events[i], chunk.num_events = chunk_header.num_events;
+    if (chunk.num_events == 0 || chunk.first_event != num_chunk_events)
+      corrupted("inconsistent events numbering in chunk " + std::to_string(i));
+    num_chunk_events += chunk.num_events;
+    const auto num_particles = chunk_header.num_particles;
+    const auto column = [&read](auto*& ptr, size_t size) {
+      ptr = reinterpret_cast<std::remove_reference_t<decltype(ptr)>>(read(size * sizeof(*ptr)));
+    };
+    column(chunk.px, num_particles), column(chunk.py, num_particles), column(chunk.pz, num_particles);
+    column(chunk.energy, num_particles);
+    column(chunk.pdg_id, num_particles), column(chunk.role, num_particles), column(chunk.status, num_particles);
+    column(chunk.event_particles, chunk.num_events + 1);
+    column(chunk.particle_mothers, num_particles + 1);
+    column(chunk.mothers, chunk_header.num_mothers);
+    column(chunk.event_metadata, chunk.num_events + 1);
+    column(chunk.metadata_keys, chunk_header.num_metadata);
+    column(chunk.metadata_values, chunk_header.num_metadata);
+    const auto* keys = read(chunk_header.keys_size);
+    for (size_t j = 0, pos = 0; j < chunk_header.num_keys; ++j) {  // intern the metadata keys used in this chunk
+      if (pos >= chunk_header.keys_size)
+        corrupted("metadata keys overflowing their block in chunk " + std::to_string(i));
+      const std::string name(keys + pos, ::strnlen(keys + pos, chunk_header.keys_size - pos));
+      chunk.keys.emplace_back(Event::EventMetadata::key(name));
+      pos += name.size() + 1;
+    }
+    // offsets columns must be monotonic and span their whole target column, and indices must remain in their range
+    const auto monotonic = [](const uint32_t* column, size_t size, uint32_t last) {
+      return column[0] == 0 && std::is_sorted(column, column + size + 1) && column[size] == last;
+    };
+    if (!monotonic(chunk.event_particles, chunk.num_events, num_particles) ||
+        !monotonic(chunk.particle_mothers, num_particles, chunk_header.num_mothers) ||
+        !monotonic(chunk.event_metadata, chunk.num_events, chunk_header.num_metadata))
+      corrupted("inconsistent offsets in chunk " + std::to_string(i));
+    for (size_t event = 0; event < chunk.num_events; ++event) {
+      const auto first_particle = chunk.event_particles[event], last_particle = chunk.event_particles[event + 1];
+      for (auto j = chunk.particle_mothers[first_particle]; j < chunk.particle_mothers[last_particle]; ++j)
+        if (chunk.mothers[j] >= last_particle - first_particle)
+          corrupted("mother index out of its event in chunk " + std::to_string(i));
+    }
+    if (std::any_of(chunk.metadata_keys, chunk.metadata_keys + chunk_header.num_metadata, [&chunk](uint32_t key) {
+          return key >= chunk.keys.size();
+        }))
+      corrupted("metadata key index out of range in chunk " + std::to_string(i));
+  }
+  if (num_chunk_events != num_events_)
+    corrupted("events multiplicity not matching the chunks content");
+  CG_DEBUG("BinaryEventReader") << "Binary events file '" << path << "' mapped with " << num_events_
+                                << " event(s) in " << chunks_.size() << " chunk(s).";
+}
+
+bool BinaryEventReader::isBinaryEventFile(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  char magic[sizeof(kBinaryEventsMagic)];
+  return file.read(magic, sizeof(magic)) && std::memcmp(magic, kBinaryEventsMagic, sizeof(kBinaryEventsMagic)) == 0;
+}
+
+BinaryEventReader::EventView BinaryEventReader::operator[](size_t event_index) const {
+  if (event_index >= num_events_)
+    throw CG_FATAL("BinaryEventReader") << "Event index " << event_index << " is out of range (" << num_events_
+                                        << " event(s) stored).";
+  const auto chunk = std::prev(std::upper_bound(  // last chunk starting at, or before, the requested event
+      chunks_.begin(), chunks_.end(), event_index, [](size_t index, const Chunk& chunk) {
+        return index < chunk.first_event;
+      }));
+  return EventView(*chunk, event_index - chunk->first_event);
+}
+
+BinaryEventReader::EventView::EventView(const Chunk& chunk, size_t event)
+    : chunk_(&chunk),
+      event_(event),
+      first_particle_(chunk.event_particles[event]),
+      num_particles_(chunk.event_particles[event + 1] - first_particle_) {}
+
+float BinaryEventReader::EventView::metadata(Event::EventMetadata::Key key) const {
+  for (auto i = chunk_->event_metadata[event_]; i < chunk_->event_metadata[event_ + 1]; ++i)
+    if (chunk_->keys[chunk_->metadata_keys[i]] == key)
+      return chunk_->metadata_values[i];
+  return -1.f;
+}
+
+void BinaryEventReader::EventView::fill(Event& event) const {
+  event.clear();
+  for (size_t i = 0; i < num_particles_; ++i) {  // first loop to populate the particles content
+    Particle particle(role(i));
+    particle.setIntegerPdgId(pdgId(i)).setMomentum(momentum(i), true);
+    event.addParticle(particle);
+  }
+  for (size_t i = 0; i < num_particles_; ++i) {  // second loop to associate the parentage
+    auto& particle = event[i];
+    for (auto [mother, end] = mothers(i); mother != end; ++mother)
+      particle.addMother(event[*mother]);
+  }
+  for (size_t i = 0; i < num_particles_; ++i)  // statuses are set last, as the parentage may modify them
+    event[i].setStatus(status(i));
+  for (auto i = chunk_->event_metadata[event_]; i < chunk_->event_metadata[event_ + 1]; ++i)
+    event.metadata[chunk_->keys[chunk_->metadata_keys[i]]] = chunk_->metadata_values[i];
+}
+
+//----- writer
+
+BinaryEventWriter::BinaryEventWriter(const std::string& path, size_t chunk_size)
+    : path_(path), file_(path, std::ios::binary | std::ios::trunc), chunk_size_(std::max(chunk_size, size_t{1})) {
+  if (!file_)
+    throw CG_FATAL("BinaryEventWriter") << "Failed to open binary events file '" << path_ << "' for writing.";
+  BinaryEventsHeader header{};  // index position is only known once all events are written
+  std::memcpy(header.magic, kBinaryEventsMagic, sizeof(kBinaryEventsMagic));
+  header.version = kBinaryEventsVersion;
+  file_.write(reinterpret_cast<const char*>(&header), sizeof(BinaryEventsHeader));
+  clear();
+}
+
+BinaryEventWriter::~BinaryEventWriter() {
+  flush();
+  BinaryEventsIndex index{cross_section_, cross_section_.uncertainty(), chunk_offsets_.size()};
+  BinaryEventsHeader header{};
+  std::memcpy(header.magic, kBinaryEventsMagic, sizeof(kBinaryEventsMagic));
+  header.version = kBinaryEventsVersion, header.index_offset = file_.tellp(), header.num_events = num_events_;
+  file_.write(reinterpret_cast<const char*>(&index), sizeof(BinaryEventsIndex));
+  file_.write(reinterpret_cast<const char*>(chunk_offsets_.data()), chunk_offsets_.size() * sizeof(uint64_t));
+  file_.write(reinterpret_cast<const char*>(chunk_first_events_.data()),
+              chunk_first_events_.size() * sizeof(uint64_t));
+  file_.seekp(0);
+  file_.write(reinterpret_cast<const char*>(&header), sizeof(BinaryEventsHeader));
+  if (!file_)  // no exception may leave a destructor, and write failures are only reported
+    CG_WARNING("BinaryEventWriter") << "Failed to write the index of binary events file '" << path_ << "'.";
+  else
+    CG_DEBUG("BinaryEventWriter") << "Binary events file '" << path_ << "' written with " << num_events_
+                                  << " event(s) in " << chunk_offsets_.size() << " chunk(s).";
+}
+
+void BinaryEventWriter::write(const Event& event) {
+  const auto particles = event.particles();
+  particle_index_.clear();
+  for (size_t i = 0; i < particles.size(); ++i) {  // map the particles identifiers to their index in the event
+    const auto id = particles[i].id();
+    if (id >= static_cast<int>(particle_index_.size()))
+      particle_index_.resize(id + 1, -1);
+    particle_index_[id] = i;
+  }
+  for (const auto& particle : particles) {
+    const auto& momentum = particle.momentum();
+    px_.emplace_back(momentum.px()), py_.emplace_back(momentum.py()), pz_.emplace_back(momentum.pz());
+    energy_.emplace_back(momentum.energy());
+    pdg_id_.emplace_back(particle.integerPdgId());
+    role_.emplace_back(static_cast<int32_t>(particle.role()));
+    status_.emplace_back(static_cast<int32_t>(particle.status()));
+    for (const auto& mother : particle.mothers())
+      if (mother >= 0 && mother < static_cast<int>(particle_index_.size()) && particle_index_[mother] >= 0)
+        mothers_.emplace_back(particle_index_[mother]);
+    particle_mothers_.emplace_back(mothers_.size());
+  }
+  event_particles_.emplace_back(px_.size());
+  for (const auto& name : event.metadata.keys()) {
+    const auto key = Event::EventMetadata::key(name);
+    if (key >= chunk_keys_.size())
+      chunk_keys_.resize(key + 1, -1);
+    if (chunk_keys_[key] < 0)  // first occurrence of this key in the chunk
+      chunk_keys_[key] = keys_.size(), keys_.emplace_back(name);
+    metadata_keys_.emplace_back(chunk_keys_[key]);
+    metadata_values_.emplace_back(event.metadata(key));
+  }
+  event_metadata_.emplace_back(metadata_keys_.size());
+  if (++num_events_; event_particles_.size() > chunk_size_) {
+    flush();
+    if (!file_)
+      throw CG_FATAL("BinaryEventWriter") << "Failed to write an events chunk to '" << path_ << "'.";
+  }
+}
+
+void BinaryEventWriter::flush() {
+  const auto num_events = event_particles_.size() - 1;
+  if (num_events == 0)
+    return;
+  chunk_offsets_.emplace_back(file_.tellp());
+  chunk_first_events_.emplace_back(num_events_ - num_events);
+  std::string keys;
+  for (const auto& key : keys_)
+    keys += key + '\0';
+  BinaryEventsChunkHeader header{static_cast<uint32_t>(num_events),
+                                 static_cast<uint32_t>(px_.size()),
+                                 static_cast<uint32_t>(mothers_.size()),
+                                 static_cast<uint32_t>(metadata_keys_.size()),
+                                 static_cast<uint32_t>(keys_.size()),
+                                 static_cast<uint32_t>(keys.size())};
+  file_.write(reinterpret_cast<const char*>(&header), sizeof(BinaryEventsChunkHeader));
+  size_t size = 0;
+  const auto write = [this, &size](const auto& column) {
+    const auto column_size = column.size() * sizeof(column[0]);
+    file_.write(reinterpret_cast<const char*>(column.data()), column_size);
+    size += column_size;
+  };
+  write(px_), write(py_), write(pz_), write(energy_), write(pdg_id_), write(role_), write(status_);
+  write(event_particles_), write(particle_mothers_), write(mothers_);
+  write(event_metadata_), write(metadata_keys_), write(metadata_values_), write(keys);
+  file_.write(kBinaryEventsMagic, padding(size));  // padding content is irrelevant
+  clear();
+}
+
+void BinaryEventWriter::clear() {
+  for (auto* column : {&px_, &py_, &pz_, &energy_})
+    column->clear();
+  for (auto* column : {&pdg_id_, &role_, &status_})
+    column->clear();
+  for (auto* column : {&event_particles_, &particle_mothers_, &event_metadata_})
+    *column = {0};
+  mothers_.clear(), metadata_keys_.clear(), metadata_values_.clear(), keys_.clear();
+  std::fill(chunk_keys_.begin(), chunk_keys_.end(), -1);
+}
@@ -18,44 +18,77 @@
 
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_math.h>
+#include <unistd.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
 #include <limits>
 
 #include "CepGen/Core/Exception.h"
+#include "CepGen/Utils/Filesystem.h"
 #include "CepGen/Utils/GridHandler.h"
+#include "CepGen/Utils/MappedFile.h"
+#include "CepGen/Utils/UniformGrid.h"
 
 //#define GRID_HANDLER_DEBUG 1
 
 using namespace cepgen;
 
+namespace {
+  /// Binary grid file layout (native endianness), all blocks aligned on 8 bytes:
+  /// - header (magic, dimension, number of values, grid type),
+  /// - number of nodes along each dimension (D x uint64),
+  /// - metadata length (uint64) and content,
+  /// - nodes coordinates (transformed according to the grid type), for each dimension,
+  /// - nodes values (N per node), in row-major order (last coordinate fastest).
+  constexpr char kBinaryGridMagic[8] = {'C', 'G', 'N', 'O', 'D', 'E', 'S', '1'};  ///< distinct from grid cache files
+  struct BinaryGridHeader {
+    char magic[8];
+    uint32_t dimension, num_values, grid_type, reserved;
+  };
+  static_assert(sizeof(BinaryGridHeader) == 24, "Unexpected binary grid header padding.");
+  constexpr size_t padding(size_t size) { return (8 - size % 8) % 8; }
+}  // namespace
+
 template <size_t D, size_t N>
-GridHandler<D, N>::GridHandler(const GridType& grid_type) : grid_type_(grid_type) {
-  for (size_t i = 0; i < D; ++i)
-    accelerators_.emplace_back(gsl_interp_accel_alloc(), gsl_interp_accel_free);
-}
+GridHandler<D, N>::GridHandler(const GridType& grid_type, const GridKernel& kernel)
+    : grid_type_(grid_type), kernel_(kernel) {}
 
 template <size_t D, size_t N>
 typename GridHandler<D, N>::values_t GridHandler<D, N>::eval(const coord_t& in_coords) const {
+  accel_t accelerators{};
+  return eval(in_coords, accelerators);
+}
+
+template <size_t D, size_t N>
+typename GridHandler<D, N>::values_t GridHandler<D, N>::eval(const coord_t& in_coords, accel_t& accelerators) const {
   if (!initialised_)
     throw CG_FATAL("GridHandler") << "Grid extrapolator called but not initialised!";
 
+  std::array<double, D> coord{};
+  for (size_t i = 0; i < D; ++i)
+    switch (grid_type_) {
+      case GridType::logarithmic:
+        coord[i] = std::log10(in_coords.at(i));
+        break;
+      case GridType::square:
+        coord[i] = in_coords.at(i) * in_coords.at(i);
+        break;
+      default:
+        coord[i] = in_coords.at(i);
+        break;
+    }
+  if (dense_)
+    return evalDense(coord);
   values_t out{};
-  coord_t coord = in_coords;
-  switch (grid_type_) {
-    case GridType::logarithmic: {
-      std::transform(coord.begin(), coord.end(), coord.begin(), [](const auto& c) { return log10(c); });
-    } break;
-    case GridType::square: {
-      std::transform(coord.begin(), coord.end(), coord.begin(), [](const auto& c) { return c * c; });
-    } break;
-    default:
-      break;
-  }
   switch (D) {  // dimension of the vector space coordinate to evaluate
     case 1: {
       for (size_t i = 0; i < N; ++i) {
-        if (const auto res =
-                gsl_spline_eval_e(splines_1d_.at(i).get(), coord.at(0), accelerators_.at(0).get(), &out[i]);
+        if (const auto res = gsl_spline_eval_e(splines_1d_.at(i).get(), coord.at(0), &accelerators.at(0), &out[i]);
             res != GSL_SUCCESS) {
           out[i] = 0.;
           CG_WARNING("GridHandler") << "Failed to evaluate the value (N=" << i << ") "
@@ -64,12 +97,12 @@ typename GridHandler<D, N>::values_t GridHandler<D, N>::eval(const coord_t& in_c
         }
       }
     } break;
-    case 2: {
 #ifdef GSL_VERSION_ABOVE_2_1
+    case 2: {
       const double x = coord.at(0), y = coord.at(1);
       for (size_t i = 0; i < N; ++i) {
         if (const auto res = gsl_spline2d_eval_e(
-                splines_2d_.at(i).get(), x, y, accelerators_.at(0).get(), accelerators_.at(1).get(), &out[i]);
+                splines_2d_.at(i).get(), x, y, &accelerators.at(0), &accelerators.at(1), &out[i]);
             res != GSL_SUCCESS) {
           out[i] = 0.;
           CG_WARNING("GridHandler") << "Failed to evaluate the value (N=" << i << ") "
@@ -77,48 +110,8 @@ typename GridHandler<D, N>::values_t GridHandler<D, N>::eval(const coord_t& in_c
                                     << ". GSL error: " << gsl_strerror(res);
         }
       }
-#else
-      //--- retrieve the indices of the bin in the set
-      coord_t before(D), after(D);
-      findIndices(coord, before, after);
-      //--- find boundaries values
-      const gridpoint_t &ext_11 = values_raw_.at({before[0], before[1]}),
-                        &ext_12 = values_raw_.at({before[0], after[1]}),
-                        &ext_21 = values_raw_.at({after[0], before[1]}), &ext_22 = values_raw_.at({after[0], after[1]});
-      //--- now that we have the boundaries, we may interpolate
-      coord_t c_d(D);
-      for (size_t i = 0; i < D; ++i)
-        c_d[i] = (after[i] != before[i]) ? (coord.at(i) - before[i]) / (after[i] - before[i]) : 0.;
-      const gridpoint_t ext_1 = ext_11 * (1. - c_d[0]) + ext_21 * c_d[0];
-      const gridpoint_t ext_2 = ext_12 * (1. - c_d[0]) + ext_22 * c_d[0];
-      out = ext_1 * (1. - c_d[1]) + ext_2 * c_d[1];
-#endif
-    } break;
-    case 3: {
-      // retrieve the indices of the bin in the set
-      coord_t before(D), after(D);
-      findIndices(coord, before, after);
-      // find boundaries values
-      const grid_point_t &ext_111 = values_raw_.at({before[0], before[1], before[2]}),
-                         &ext_112 = values_raw_.at({before[0], before[1], after[2]}),
-                         &ext_121 = values_raw_.at({before[0], after[1], before[2]}),
-                         &ext_122 = values_raw_.at({before[0], after[1], after[2]}),
-                         &ext_211 = values_raw_.at({after[0], before[1], before[2]}),
-                         &ext_212 = values_raw_.at({after[0], before[1], after[2]}),
-                         &ext_221 = values_raw_.at({after[0], after[1], before[2]}),
-                         &ext_222 = values_raw_.at({after[0], after[1], after[2]});
-      // now that we have the boundaries, we may interpolate
-      coord_t c_d(D);
-      for (size_t i = 0; i < D; ++i)
-        c_d[i] = (after[i] != before[i]) ? (coord.at(i) - before[i]) / (after[i] - before[i]) : 0.;
-      const grid_point_t ext_11 = ext_111 * (1. - c_d[0]) + ext_211 * c_d[0];
-      const grid_point_t ext_12 = ext_112 * (1. - c_d[0]) + ext_212 * c_d[0];
-      const grid_point_t ext_21 = ext_121 * (1. - c_d[0]) + ext_221 * c_d[0];
-      const grid_point_t ext_22 = ext_122 * (1. - c_d[0]) + ext_222 * c_d[0];
-      const grid_point_t ext_1 = ext_11 * (1. - c_d[1]) + ext_21 * c_d[1];
-      const grid_point_t ext_2 = ext_12 * (1. - c_d[1]) + ext_22 * c_d[1];
-      out = ext_1 * (1. - c_d[2]) + ext_2 * c_d[2];
     } break;
+#endif
     default:
       throw CG_FATAL("GridHandler") << "Unsupported number of dimensions: " << N << ".\n\t"
                                     << "Please contact the developers to add such a new feature.";
@@ -126,6 +119,71 @@ typename GridHandler<D, N>::values_t GridHandler<D, N>::eval(const coord_t& in_c
   return out;
 }
 
+template <size_t D, size_t N>
+void GridHandler<D, N>::evalBatch(const std::vector<coord_t>& in_coords, std::vector<values_t>& out_values) const {
+  out_values.resize(in_coords.size());
+  accel_t accelerators{};  // shared along the batch, as consecutive coordinates are likely to lie in close cells
+  for (size_t i = 0; i < in_coords.size(); ++i)
+    out_values[i] = eval(in_coords[i], accelerators);
+}
+
+template <size_t D, size_t N>
+typename GridHandler<D, N>::values_t GridHandler<D, N>::evalDense(const std::array<double, D>& coord) const {
+  // first step: find the nodes stencil and its interpolation weights along each dimension
+  std::array<std::array<size_t, 4>, D> nodes{};
+  std::array<size_t, D> num{};
+  std::array<std::array<double, 4>, D> weights{};
+  for (size_t i = 0; i < D; ++i) {
+    const auto& axis = coordinates_[i];
+    const auto num_nodes = axis.size();
+    if (num_nodes == 1) {
+      num[i] = 1, weights[i][0] = 1.;
+      continue;
+    }
+    if (kernel_ == GridKernel::cubic) {  // same Catmull-Rom kernel as the uniform grids
+      if (inv_steps_[i] > 0.)
+        catmullRomStencil((coord[i] - axis.front()) * inv_steps_[i], num_nodes, nodes[i], weights[i]);
+      else
+        catmullRomStencil(axis, coord[i], nodes[i], weights[i]);
+      num[i] = 4;
+      continue;
+    }
+    // linear interpolation within the cell
+    const auto x = std::clamp(coord[i], axis.front(), axis.back());  // coordinates are clamped to the grid boundaries
+    size_t cell;  // index of the lower node of the cell containing the coordinate
+    if (inv_steps_[i] > 0.)
+      cell = std::min(static_cast<size_t>((x - axis.front()) * inv_steps_[i]), num_nodes - 2);
+    else
+      cell = std::min<size_t>(std::upper_bound(axis.begin() + 1, axis.end(), x) - axis.begin(), num_nodes - 1) - 1;
+    const auto t = (x - axis[cell]) / (axis[cell + 1] - axis[cell]);
+    nodes[i][0] = cell, nodes[i][1] = cell + 1, num[i] = 2;
+    weights[i][0] = 1. - t, weights[i][1] = t;
+  }
+  // second step: tensor product of all one-dimensional kernels
+  values_t out{};
+  std::array<size_t, D> offset{};
+  while (true) {
+    double weight = 1.;
+    size_t index = 0;
+    for (size_t i = 0; i < D; ++i) {
+      weight *= weights[i][offset[i]];
+      index += nodes[i][offset[i]] * strides_[i];
+    }
+    const auto* node = nodes_ + index * N;
+    for (size_t j = 0; j < N; ++j)
+      out[j] += weight * node[j];
+    size_t dim = D;  // increment the stencil offsets, last dimension fastest
+    for (; dim > 0; --dim) {
+      if (++offset[dim - 1] < num[dim - 1])
+        break;
+      offset[dim - 1] = 0;
+    }
+    if (dim == 0)
+      break;
+  }
+  return out;
+}
+
 template <size_t D, size_t N>
 void GridHandler<D, N>::insert(const coord_t& coord, values_t value) {
   auto modified_coordinate = coord;
@@ -152,6 +210,8 @@ void GridHandler<D, N>::initialise() {
   if (values_raw_.empty())
     throw CG_ERROR("GridHandler") << "Empty grid.";
   gsl_set_error_handler_off();
+  dense_ = false;
+  mapping_.reset();
   //--- start by building grid coordinates from raw values
   for (auto& coordinate : coordinates_)
     coordinate.clear();
@@ -165,6 +225,7 @@ void GridHandler<D, N>::initialise() {
   }
   for (auto& c : coordinates_)
     std::sort(c.begin(), c.end());
+  initialiseIndexing();
 #ifdef GRID_HANDLER_DEBUG
   CG_DEBUG("GridHandler").log([&](auto& dbg) {
     dbg << "Grid dump:";
@@ -216,6 +277,10 @@ void GridHandler<D, N>::initialise() {
     } break;
     case 2: {  //--- (x,y) |-> (f1,...)
 #ifdef GSL_VERSION_ABOVE_2_1
+      if (kernel_ == GridKernel::cubic) {  // dense grid interpolation
+        initialiseDense();
+        break;
+      }
       if (values_raw_.size() < gsl_interp2d_type_min_size(gsl_interp2d_bicubic))
         CG_WARNING("GridHandler") << "The grid size is too small (" << values_raw_.size() << " < "
                                   << gsl_interp2d_type_min_size(gsl_interp2d_bicubic)
@@ -256,9 +321,11 @@ void GridHandler<D, N>::initialise() {
       CG_WARNING("GridHandler") << "GSL version ≥ 2.1 is required for spline bilinear interpolation.\n\t"
                                 << "Version " << GSL_VERSION << " is installed on this system!\n\t"
                                 << "Will use a simple bilinear approximation instead.";
+      initialiseDense();
 #endif
     } break;
-    default:
+    default:  //--- (x,y,z,...) |-> (f1,...)
+      initialiseDense();
       break;
   }
   initialised_ = true;
@@ -304,44 +371,155 @@ std::array<double, D> GridHandler<D, N>::max() const {
 }
 
 template <size_t D, size_t N>
-void GridHandler<D, N>::findIndices(const coord_t& coord, coord_t& min, coord_t& max) const {
+std::string GridHandler<D, N>::load(const std::string& path) {
+  auto mapping = std::make_shared<const utils::MappedFile>(path);
+  const auto* begin = mapping->data();
+  size_t offset = 0;
+  const auto read = [&](size_t size) {  // retrieve a block of the mapped file, and check its boundaries
+    if (size > mapping->size() - offset)  // offset never exceeds the file size; no wrap-around of untrusted sizes
+      throw CG_FATAL("GridHandler:load") << "Binary grid file '" << path << "' is truncated.";
+    const auto* ptr = begin + offset;
+    offset += size;
+    return ptr;
+  };
+  BinaryGridHeader header;
+  std::memcpy(&header, read(sizeof(BinaryGridHeader)), sizeof(BinaryGridHeader));
+  if (std::memcmp(header.magic, kBinaryGridMagic, sizeof(kBinaryGridMagic)) != 0)
+    throw CG_FATAL("GridHandler:load") << "File '" << path << "' is not a binary grid file.";
+  if (header.dimension != D || header.num_values != N)
+    throw CG_FATAL("GridHandler:load") << "Binary grid file '" << path << "' holds a " << header.dimension
+                                       << "D grid with " << header.num_values << " value(s) per node, while a " << D
+                                       << "D grid with " << N << " value(s) per node was expected.";
+  if (header.grid_type != static_cast<uint32_t>(grid_type_))
+    throw CG_FATAL("GridHandler:load") << "Binary grid file '" << path << "' was built for another grid type.";
+  std::array<uint64_t, D> sizes{};
+  std::memcpy(sizes.data(), read(D * sizeof(uint64_t)), D * sizeof(uint64_t));
+  uint64_t metadata_size;
+  std::memcpy(&metadata_size, read(sizeof(uint64_t)), sizeof(uint64_t));
+  const std::string metadata(read(metadata_size), metadata_size);
+  read(padding(metadata_size));
+  // all nodes values must fit in the file; bounds the untrusted sizes before any multiplication
+  const size_t max_num_nodes = mapping->size() / (N * sizeof(double));
+  size_t num_nodes = 1;
   for (size_t i = 0; i < D; ++i) {
-    if (const auto& coordinate_i = coordinates_.at(i);  // extract all coordinates registered for this dimension
-        coord.at(i) < *coordinate_i.begin()) {          // under the range
-      CG_DEBUG_LOOP("GridHandler:indices") << "Coordinate " << i << " in underflow range "
-                                           << "(" << coord.at(i) << " < " << *coordinate_i.begin() << ").";
-      min[i] = max[i] = *coordinate_i.begin();
-    } else if (coord.at(i) > *coordinate_i.rbegin()) {  // over the range
-      CG_DEBUG_LOOP("GridHandler:indices") << "Coordinate " << i << " in overflow range "
-                                           << "(" << coord.at(i) << " > " << *coordinate_i.rbegin() << ").";
-      min[i] = max[i] = *coordinate_i.rbegin();
-    } else {  // in between two coordinates
-      auto it_coord = std::lower_bound(coordinate_i.begin(), coordinate_i.end(), coord.at(i));
-      max[i] = *it_coord;
-      if (it_coord != coordinate_i.begin())
-        --it_coord;
-      min[i] = *it_coord;
+    if (sizes[i] == 0)
+      throw CG_FATAL("GridHandler:load") << "Binary grid file '" << path << "' has an empty axis " << i << ".";
+    if (sizes[i] > max_num_nodes / num_nodes)
+      throw CG_FATAL("GridHandler:load") << "Binary grid file '" << path << "' is truncated.";
+    const auto* coord = reinterpret_cast<const double*>(read(sizes[i] * sizeof(double)));
+    coordinates_[i].assign(coord, coord + sizes[i]);
+    if (std::adjacent_find(coordinates_[i].begin(), coordinates_[i].end(), std::greater_equal<double>()) !=
+        coordinates_[i].end())
+      throw CG_FATAL("GridHandler:load") << "Binary grid file '" << path
+                                         << "' has non-increasing coordinates along axis " << i << ".";
+    num_nodes *= sizes[i];
+  }
+  const auto* values = reinterpret_cast<const double*>(read(num_nodes * N * sizeof(double)));
+
+  values_raw_.clear();
+  if (D == 1) {  // spline interpolation requires its own copy of the nodes values
+    for (size_t i = 0; i < num_nodes; ++i) {
+      values_t val;
+      std::copy(values + i * N, values + (i + 1) * N, val.begin());
+      values_raw_[coord_t{coordinates_[0][i]}] = val;
     }
+    initialise();
+  } else {  // dense grid interpolation directly from the mapped nodes values
+    initialiseIndexing();
+    nodes_values_.clear();
+    nodes_ = values, mapping_ = mapping;
+    dense_ = initialised_ = true;
   }
+  CG_DEBUG("GridHandler:load") << "Binary grid loaded from '" << path << "' with boundaries: " << boundaries() << ".";
+  return metadata;
 }
 
-//----------------------------------------------------------------------------
-// grid manipulation utility
-//----------------------------------------------------------------------------
+template <size_t D, size_t N>
+void GridHandler<D, N>::save(const std::string& path, const std::string& metadata) const {
+  if (!initialised_)
+    throw CG_FATAL("GridHandler:save") << "Grid must be initialised before being stored.";
+  // nodes values are retrieved before writing, as they may be mapped from the destination file itself; the file is
+  // written to a process-specific path then moved, so that its current mappings (in any job) remain valid
+  const auto values = denseValues();
+  const auto tmp_path = path + "." + std::to_string(::getpid());
+  std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+  if (!file)
+    throw CG_FATAL("GridHandler:save") << "Failed to open binary grid file '" << tmp_path << "' for writing.";
+  BinaryGridHeader header{};
+  std::memcpy(header.magic, kBinaryGridMagic, sizeof(kBinaryGridMagic));
+  header.dimension = D, header.num_values = N, header.grid_type = static_cast<uint32_t>(grid_type_);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(BinaryGridHeader));
+  for (const auto& coordinate : coordinates_) {
+    const uint64_t size = coordinate.size();
+    file.write(reinterpret_cast<const char*>(&size), sizeof(uint64_t));
+  }
+  const uint64_t metadata_size = metadata.size();
+  file.write(reinterpret_cast<const char*>(&metadata_size), sizeof(uint64_t));
+  file.write(metadata.data(), metadata_size);
+  file.write(kBinaryGridMagic, padding(metadata_size));  // padding content is irrelevant
+  for (const auto& coordinate : coordinates_)
+    file.write(reinterpret_cast<const char*>(coordinate.data()), coordinate.size() * sizeof(double));
+  file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+  if (file.close(); !file)
+    throw CG_FATAL("GridHandler:save") << "Failed to write the binary grid file '" << tmp_path << "'.";
+  fs::rename(tmp_path, path);
+  CG_DEBUG("GridHandler:save") << "Grid stored in binary grid file '" << path << "'.";
+}
 
 template <size_t D, size_t N>
-typename GridHandler<D, N>::grid_point_t GridHandler<D, N>::grid_point_t::operator*(double c) const {
-  grid_point_t out = *this;
-  std::transform(out.begin(), out.end(), out.begin(), [&c](const auto& a) { return a * c; });
-  return out;
+bool GridHandler<D, N>::isBinaryGrid(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  char magic[sizeof(kBinaryGridMagic)];
+  return file.read(magic, sizeof(magic)) && std::memcmp(magic, kBinaryGridMagic, sizeof(magic)) == 0;
 }
 
 template <size_t D, size_t N>
-typename GridHandler<D, N>::grid_point_t GridHandler<D, N>::grid_point_t::operator+(const grid_point_t& rhs) const {
-  grid_point_t out = *this;
-  for (size_t i = 0; i < out.size(); ++i)
-    out[i] += rhs[i];
-  return out;
+void GridHandler<D, N>::initialiseIndexing() {
+  size_t num_nodes = 1;
+  for (size_t i = D; i > 0; --i) {  // row-major ordering, last coordinate fastest
+    const auto& axis = coordinates_.at(i - 1);
+    strides_[i - 1] = num_nodes;
+    num_nodes *= axis.size();
+    // check whether the nodes are equally spaced along this dimension, for a direct index computation
+    inv_steps_[i - 1] = 0.;
+    if (axis.size() < 2)
+      continue;
+    const auto step = (axis.back() - axis.front()) / (axis.size() - 1);
+    bool equally_spaced = step > 0.;
+    for (size_t j = 1; j < axis.size() && equally_spaced; ++j)
+      equally_spaced = std::fabs(axis.at(j) - axis.front() - j * step) <= 1.e-9 * (axis.back() - axis.front());
+    if (equally_spaced)
+      inv_steps_[i - 1] = 1. / step;
+  }
+}
+
+template <size_t D, size_t N>
+void GridHandler<D, N>::initialiseDense() {
+  nodes_values_ = denseValues();
+  nodes_ = nodes_values_.data();
+  dense_ = true;
+}
+
+template <size_t D, size_t N>
+std::vector<double> GridHandler<D, N>::denseValues() const {
+  size_t num_nodes = 1;
+  for (const auto& coordinate : coordinates_)
+    num_nodes *= coordinate.size();
+  if (dense_ && nodes_)  // nodes values are already densely stored
+    return std::vector<double>(nodes_, nodes_ + num_nodes * N);
+  std::vector<double> values(num_nodes * N, 0.);
+  for (const auto& [coordinate, value] : values_raw_) {
+    size_t index = 0;
+    for (size_t i = 0; i < D; ++i) {
+      const auto& axis = coordinates_[i];
+      index += strides_[i] * std::distance(axis.begin(), std::lower_bound(axis.begin(), axis.end(), coordinate[i]));
+    }
+    std::copy(value.begin(), value.end(), values.begin() + index * N);
+  }
+  if (values_raw_.size() < num_nodes)
+    CG_WARNING("GridHandler") << "Grid is not fully populated (" << values_raw_.size() << " nodes out of " << num_nodes
+                              << "). Missing nodes values are set to zero.";
+  return values;
 }
 
 namespace cepgen {  // template specialisation for the few cases handled
@@ -16,6 +16,13 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <thread>
+
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Core/GeneratorWorker.h"
 #include "CepGen/Core/RunParameters.h"
@@ -25,19 +32,31 @@
 #include "CepGen/Modules/GeneratorWorkerFactory.h"
 #include "CepGen/Modules/RandomGeneratorFactory.h"
 #include "CepGen/Process/Process.h"
+#include "CepGen/Utils/AliasTable.h"
 #include "CepGen/Utils/ProgressBar.h"
 #include "CepGen/Utils/RandomGenerator.h"
 #include "CepGen/Utils/String.h"
 #include "CepGen/Utils/TimeKeeper.h"
 
 using namespace cepgen;
+using namespace std::string_literals;
 
 /// A Vegas grid-aware optimised event generator
 class GridOptimisedGeneratorWorker final : public GeneratorWorker {
 public:
   explicit GridOptimisedGeneratorWorker(const ParametersList& params)
       : GeneratorWorker(params),
-        random_generator_(RandomGeneratorFactory::get().build(steer<ParametersList>("randomGenerator"))) {}
+        random_generator_(RandomGeneratorFactory::get().build(steer<ParametersList>("randomGenerator"))),
+        alias_selection_(steer<std::string>("binSelection") == "alias"),
+        num_threads_(steer<int>("numThreads")),
+        max_grid_memory_(steer<int>("maxGridMemory")),
+        num_batch_trials_(steer<int>("numBatchTrials")) {
+    if (max_grid_memory_ <= 0)
+      throw CG_FATAL("GridOptimisedGeneratorWorker") << "Invalid grid memory budget: " << max_grid_memory_ << " MiB.";
+    if (num_batch_trials_ <= 0)
+      throw CG_FATAL("GridOptimisedGeneratorWorker")
+          << "Invalid number of unweighting trials per batch: " << num_batch_trials_ << ".";
+  }
 
   static ParametersDescription description() {
     auto desc = GeneratorWorker::description();
@@ -45,17 +64,58 @@ public:
     desc.add("randomGenerator", RandomGeneratorFactory::get().describeParameters("stl"))
         .setDescription("random number generator engine");
     desc.add("binSize", 3);
+    desc.add("binSelection", "uniform"s)
+        .allow("uniform", "uniform bin selection, with a rejection against the global function maximum")
+        .allow("alias", "bin selection in proportion to the local function maximum, through a Walker/Vose alias table")
+        .setDescription("phase space bin selection algorithm for the unweighted events generation");
+    desc.add("maxGridMemory", 4096)
+        .setDescription("maximal memory (in MiB) allowed for the per-bin counters and function maxima of the grid");
+    desc.add("numBatchTrials", 64)
+        .setDescription("number of unweighting trials whose function values are evaluated in one batch");
+    desc.add("numThreads", 1)
+        .setDescription("number of threads used for the generation grid preparation (0 for all available cores)");
     return desc;
   }
 
   void initialise() override {
-    grid_ = std::make_unique<GridParameters>(steer<int>("binSize"), integrand_->size());
+    // expensive event modification algorithms are only run on accepted events, if requested
+    integrand_->setDeferredModification(run_params_->generation().deferModification());
+    if (!grid_ || !grid_->prepared())  // grid may have been restored from a previous run
+      grid_ = buildGrid();
     coordinates_ = std::vector<double>(integrand_->size());
+    discardTrials();
     if (!grid_->prepared())
       computeGenerationParameters();
+    else
+      integrand_->setStorage(true);
+    if (alias_selection_) {  // build the bin selection table from the per-bin function maxima
+      grid_->setProportionalSelection(true);
+      alias_table_.build(std::vector<double>(grid_->maxValues().begin(), grid_->maxValues().end()));
+    }
     CG_DEBUG("GridOptimisedGeneratorWorker:initialise")
         << "Dim-" << integrand_->size() << " " << integrator_->name() << " integrator "
-        << "set for dim-" << grid_->n(0).size() << " grid.";
+        << "set for dim-" << grid_->numDimensions() << " grid.";
+  }
+  std::vector<double> state() const override {
+    if (!grid_ || !grid_->prepared())
+      return {};
+    std::vector<double> state{static_cast<double>(steer<int>("binSize")), static_cast<double>(integrand_->size())};
+    for (size_t i = 0; i < grid_->size(); ++i)
+      state.emplace_back(grid_->maxValue(i));
+    return state;
+  }
+  bool setState(const std::vector<double>& state) override {
+    if (!integrand_ || state.size() < 2 || static_cast<int>(state.at(0)) != steer<int>("binSize") ||
+        static_cast<size_t>(state.at(1)) != integrand_->size())
+      return false;
+    auto grid = buildGrid();
+    if (state.size() != grid->size() + 2)
+      return false;
+    for (size_t i = 0; i < grid->size(); ++i)
+      grid->setValue(i, state.at(i + 2));
+    grid->setPrepared(true);
+    grid_ = std::move(grid);
+    return true;
   }
   bool next() override {
     if (!integrator_)
@@ -64,36 +124,97 @@ public:
       throw CG_FATAL("GridOptimisedGeneratorWorker:next") << "Grid object was not initialised.";
 
     CG_TICKER(const_cast<RunParameters*>(run_params_)->timeKeeper());
-    if (ps_bin_ != UNASSIGNED_BIN) {  // apply correction cycles if required from previous event
-      bool store = false;
-      while (!correctionCycle(store)) {
+    while (true) {  // loop until an event is accepted (and survives its deferred modification)
+      if (ps_bin_ != UNASSIGNED_BIN) {  // apply correction cycles if required from previous event
+        bool store = false;
+        while (!correctionCycle(store)) {
+        }
+        updateSelection();
+        if (store) {
+          if (modifyEvent())
+            return storeEvent();
+          continue;
+        }
       }
-      if (store)
-        return storeEvent();
-    }
-    // normal generation cycle
-    double weight;
-    while (true) {
-      double y;
-      do {  // select a function value and reject if fmax is too small
-        ps_bin_ = random_generator_->uniformInt(0, grid_->size() - 1);
-        y = random_generator_->uniform(0., grid_->globalMax());
-        grid_->increment(ps_bin_);
-      } while (y > grid_->maxValue(ps_bin_));
-      grid_->shoot(*random_generator_, ps_bin_, coordinates_);    // shoot a point x in this bin
-      if (weight = integrator_->eval(*integrand_, coordinates_);  // get weight for selected x value
-          weight > y)
-        break;
+      // normal generation cycle
+      double weight;
+      while (true) {
+        if (next_trial_ >= trials_.size())
+          generateTrials();
+        const auto& trial = trials_[next_trial_++];
+        for (auto i = trial.first_selection; i < trial.last_selection; ++i)  // all bins drawn for this trial
+          grid_->increment(selected_bins_[i]);
+        ps_bin_ = selected_bins_[trial.last_selection - 1];
+        if (trial.weight <= trial.y)
+          continue;
+        // candidate event; its weight is recomputed with the event content stored
+        std::copy(trial.coordinates, trial.coordinates + coordinates_.size(), coordinates_.begin());
+        if (weight = integrator_->eval(*integrand_, coordinates_); weight > trial.y)
+          break;
+      }
+      if (weight > grid_->maxValue(ps_bin_)) {        // if weight is higher than local or global maximum,
+        grid_->initCorrectionCycle(ps_bin_, weight);  // init correction cycle for the next event
+        updateSelection();
+        discardTrials();  // pending trials were drawn from the former bins maxima
+      } else  // no grid correction needed for this bin
+        ps_bin_ = UNASSIGNED_BIN;
+      if (modifyEvent())
+        return storeEvent();  // return with an accepted event
     }
-    if (weight > grid_->maxValue(ps_bin_))          // if weight is higher than local or global maximum,
-      grid_->initCorrectionCycle(ps_bin_, weight);  // init correction cycle for the next event
-    else                                            // no grid correction needed for this bin
-      ps_bin_ = UNASSIGNED_BIN;
-    return storeEvent();  // return with an accepted event
   }
 
 private:
-  static constexpr int UNASSIGNED_BIN = -999;  ///< Placeholder for invalid bin indexing
+  static constexpr int UNASSIGNED_BIN = -999;    ///< Placeholder for invalid bin indexing
+  static constexpr size_t BINS_PER_STREAM = 16;  ///< Number of bins prepared with the same random numbers stream
+  /// Seed of a random numbers stream for engines without independent streams, decorrelated from the base seed and
+  /// other streams (SplitMix64 finaliser)
+  static unsigned long long streamSeed(unsigned long long base_seed, size_t stream) {
+    auto z = base_seed + (stream + 1) * 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    z ^= z >> 31;
+    return z > 0ull ? z : 1ull;  // a null seed would let the engine pick a non-reproducible one
+  }
+
+  /// Build an empty generation grid, within the user-steered memory budget
+  std::unique_ptr<GridParameters> buildGrid() const {
+    return std::make_unique<GridParameters>(
+        steer<int>("binSize"), integrand_->size(), static_cast<size_t>(max_grid_memory_) << 20);
+  }
+
+  /// Draw a batch of unweighting trials (bin, function value, and phase space point) from the current grid maxima, and
+  /// evaluate all their points at once, without storing their events
+  void generateTrials() {
+    const auto num_dimensions = coordinates_.size();
+    trials_.resize(num_batch_trials_);
+    selected_bins_.clear();
+    trial_points_.clear();
+    for (auto& trial : trials_) {
+      trial.first_selection = selected_bins_.size();
+      size_t bin;
+      if (alias_selection_) {  // select a bin according to its fmax, and a function value below it
+        bin = alias_table_.sample(*random_generator_);
+        trial.y = random_generator_->uniform(0., grid_->maxValue(bin));
+        selected_bins_.emplace_back(bin);
+      } else
+        do {  // select a function value and reject if fmax is too small
+          bin = random_generator_->uniformInt(0, grid_->size() - 1);
+          trial.y = random_generator_->uniform(0., grid_->globalMax());
+          selected_bins_.emplace_back(bin);
+        } while (trial.y > grid_->maxValue(bin));
+      trial.last_selection = selected_bins_.size();
+      grid_->shoot(*random_generator_, bin, coordinates_);  // shoot a point x in this bin
+      trial_points_.insert(trial_points_.end(), coordinates_.begin(), coordinates_.end());
+    }
+    integrand_->setStorage(false);
+    integrator_->evalBatch(*integrand_, trial_points_, trial_weights_);
+    integrand_->setStorage(true);
+    for (size_t i = 0; i < trials_.size(); ++i)
+      trials_[i].weight = trial_weights_[i], trials_[i].coordinates = trial_points_.data() + i * num_dimensions;
+    next_trial_ = 0;
+  }
+  /// Drop all pending unweighting trials
+  void discardTrials() { next_trial_ = trials_.size(); }
 
   /// Apply a correction cycle to the grid
   bool correctionCycle(bool& store) {
@@ -122,6 +243,20 @@ private:
     // (all your bases are belong to us...)
     return grid_->correct(ps_bin_);
   }
+  /// Run the deferred event modification algorithms on an event accepted by the unweighting
+  /// \return A boolean stating whether the event is to be kept
+  bool modifyEvent() {
+    if (!integrand_->deferredModification())
+      return true;
+    const auto branching_ratio = integrand_->modifyEvent(run_params_->generation().modificationAttempts());
+    // branching fractions are not accounted for in the unweighting, so the event is kept with this probability
+    return branching_ratio >= 1. || (branching_ratio > 0. && random_generator_->uniform() < branching_ratio);
+  }
+  /// Propagate a bin maximum modification to the bin selection table
+  void updateSelection() {
+    if (alias_selection_ && ps_bin_ != UNASSIGNED_BIN)
+      alias_table_.update(ps_bin_, grid_->maxValue(ps_bin_));
+  }
   /// Prepare the object for event generation
   void computeGenerationParameters() const {
     if (!run_params_)
@@ -134,39 +269,98 @@ private:
         << "Preparing the grid (" << utils::s("point", run_params_->generation().numPoints(), true) << "/bin) "
         << "for the generation of unweighted events.";
 
-    const auto inv_num_points = 1. / run_params_->generation().numPoints();
-    std::vector point_coord(integrand_->size(), 0.);
-    if (point_coord.size() < grid_->n(0).size())
-      throw CG_FATAL("GridParameters:setGen") << "Coordinates vector multiplicity is insufficient!";
+    const auto num_points = run_params_->generation().numPoints();
+    const auto inv_num_points = 1. / num_points;
+    if (integrand_->size() != grid_->numDimensions())
+      throw CG_FATAL("GridParameters:setGen") << "Coordinates vector multiplicity does not match the grid dimension!";
 
-    // main preparation loop
+    // build the pool of integrands (one independent copy per thread)
+    const size_t num_threads = num_threads_ > 0 ? num_threads_ : std::max(std::thread::hardware_concurrency(), 1u);
+    std::vector<std::unique_ptr<Integrand> > clones;
+    while (clones.size() + 1 < num_threads) {
+      try {
+        clones.emplace_back(integrand_->clone());
+      } catch (const Exception& exc) {
+        CG_WARNING("GridOptimisedGeneratorWorker:setGen")
+            << "Failed to clone the integrand for an additional preparation thread. Will use "
+            << utils::s("thread", clones.size() + 1, true) << ".\n\t" << exc.message();
+        break;
+      }
+    }
+
+    // main preparation loop; bins are explored by blocks, each with its own random numbers stream, so that the per-bin
+    // results (gathered in the bins order) do not depend on the number of threads
+    const auto rng_params =  // with the engine defaults, e.g. the stream index of counter-based generators
+        RandomGeneratorFactory::get().describeParameters(steer<ParametersList>("randomGenerator")).parameters();
+    auto base_seed = rng_params.get<unsigned long long>("seed");
+    if (base_seed == 0ull)  // seed chosen by the engine; derive the streams seeds from the worker stream
+      base_seed = random_generator_->uniformInt(1, std::numeric_limits<int>::max());
+    // counter-based generators (e.g. Philox) provide independent streams for a single seed; the blocks streams are
+    // offset in the upper 32 bits, as the lower ones are already shifted per generation thread (see Generator)
+    const auto counter_based = rng_params.has<unsigned long long>("stream");
+    const auto base_stream = counter_based ? rng_params.get<unsigned long long>("stream") : 0ull;
+    const auto num_blocks = (grid_->size() + BINS_PER_STREAM - 1) / BINS_PER_STREAM;
+    // only the per-bin maxima are kept until the reduction; averages are summed per block
+    std::vector<float> bin_max(grid_->size(), 0.f);
+    std::vector<std::array<double, 3> > block_sums(num_blocks, {0., 0., 0.});  // sum of av, av^2, and sigma^2
+    std::atomic<size_t> next_block{0}, num_prepared_bins{0};
     utils::ProgressBar progress_bar(grid_->size(), 5);
-    auto sum = 0., sum2 = 0., sum2p = 0.;
-    for (size_t i = 0; i < grid_->size(); ++i) {
-      auto fsum = 0., fsum2 = 0.;
-      for (size_t j = 0; j < run_params_->generation().numPoints(); ++j) {
-        grid_->shoot(*random_generator_, i, point_coord);
-        const auto weight = integrator_->eval(*integrand_, point_coord);
-        grid_->setValue(i, weight);
-        fsum += weight;
-        fsum2 += weight * weight;
+    const auto prepare_bins = [&](Integrand& integrand, bool main_thread) {
+      std::vector<double> points, weights;  // all points shot in one bin, and their associated weights
+      for (size_t block; (block = next_block++) < num_blocks;) {
+        auto block_rng_params = rng_params;
+        if (counter_based)
+          block_rng_params.set<unsigned long long>("seed", base_seed)
+              .set<unsigned long long>("stream", base_stream + ((block + 1ull) << 32));
+        else
+          block_rng_params.set<unsigned long long>("seed", streamSeed(base_seed, block));
+        const auto random_generator = RandomGeneratorFactory::get().build(block_rng_params);
+        const auto last_bin = std::min((block + 1) * BINS_PER_STREAM, grid_->size());
+        auto& [sum, sum2, sum2p] = block_sums[block];
+        for (size_t i = block * BINS_PER_STREAM; i < last_bin; ++i) {
+          auto fmax = 0., fsum = 0., fsum2 = 0.;
+          grid_->shoot(*random_generator, i, num_points, points);
+          integrator_->evalBatch(integrand, points, weights);
+          for (const auto& weight : weights) {
+            fmax = std::max(fmax, weight);
+            fsum += weight;
+            fsum2 += weight * weight;
+          }
+          const auto av = fsum * inv_num_points, av2 = fsum2 * inv_num_points, sig2 = av2 - av * av;
+          bin_max[i] = fmax;
+          sum += av;
+          sum2 += av2;
+          sum2p += sig2;
+          CG_DEBUG_LOOP("GridOptimisedGeneratorWorker:setGen")
+              .log([this, &i, &av, &sig2, &fmax](auto& log) {  // per-bin debugging loop
+                log << "n-vector for bin " << i << ": " << utils::repr(grid_->n(i)) << "\n\t"
+                    << "av   = " << av << "\n\t"
+                    << "sig  = " << std::sqrt(sig2) << "\n\t"
+                    << "fmax = " << fmax << "\n\t"
+                    << "eff  = " << (fmax != 0. ? av / fmax : 0.);
+              });
+        }
+        num_prepared_bins += last_bin - block * BINS_PER_STREAM;
+        if (main_thread)
+          progress_bar.update(num_prepared_bins);
       }
-      const auto av = fsum * inv_num_points, av2 = fsum2 * inv_num_points, sig2 = av2 - av * av;
-      sum += av;
-      sum2 += av2;
-      sum2p += sig2;
-      CG_DEBUG_LOOP("GridOptimisedGeneratorWorker:setGen")
-          .log([this, &i, &av, &sig2](auto& log) {  // per-bin debugging loop
-            const double sig = sqrt(sig2);
-            const double eff = (grid_->maxValue(i) != 0.) ? av / grid_->maxValue(i) : 0.;
-            log << "n-vector for bin " << i << ": " << utils::repr(grid_->n(i)) << "\n\t"
-                << "av   = " << av << "\n\t"
-                << "sig  = " << sig << "\n\t"
-                << "fmax = " << grid_->maxValue(i) << "\n\t"
-                << "eff  = " << eff;
-          });
-      progress_bar.update(i + 1);
-    }  // end of main preparation loop
+    };
+    std::vector<std::future<void> > jobs;
+    for (auto& clone : clones)
+      jobs.emplace_back(std::async(std::launch::async, prepare_bins, std::ref(*clone), false));
+    prepare_bins(*integrand_, true);
+    for (auto& job : jobs)
+      job.get();  // wait for all threads, and propagate any exception raised while evaluating the integrand
+
+    // deterministic reduction of the per-bin and per-block results into the grid
+    for (size_t i = 0; i < grid_->size(); ++i)
+      grid_->setValue(i, bin_max[i]);
+    auto sum = 0., sum2 = 0., sum2p = 0.;
+    for (const auto& block_sum : block_sums) {
+      sum += block_sum[0];
+      sum2 += block_sum[1];
+      sum2p += block_sum[2];
+    }
 
     CG_DEBUG("GridOptimisedGeneratorWorker:setGen").log([this, &sum, &sum2, &sum2p](auto& log) {
       const double inv_max = 1. / grid_->size();
@@ -193,8 +387,26 @@ private:
   }
 
   const std::unique_ptr<utils::RandomGenerator> random_generator_;  ///< Random number generator for grid population
+  const bool alias_selection_;            ///< Are bins selected in proportion to their function maximum?
+  const int num_threads_;                 ///< User-steered number of threads for the grid preparation
+  const int max_grid_memory_;             ///< Memory budget (in MiB) for the generation grid
+  const int num_batch_trials_;            ///< Number of unweighting trials evaluated in one batch
   std::unique_ptr<GridParameters> grid_;  ///< Set of parameters for the integration/event generation grid
+  utils::AliasTable alias_table_;         ///< Bin selection table, if bins are not selected uniformly
   int ps_bin_{UNASSIGNED_BIN};            ///< Last bin to be corrected
   std::vector<double> coordinates_;       ///< Phase space coordinates being evaluated
+
+  /// Unweighting trial drawn and evaluated in a batch
+  struct Trial {
+    size_t first_selection{0}, last_selection{0};  ///< Range of bins drawn for this trial (the last one being kept)
+    double y{0.};                                  ///< Function value to be exceeded for the trial to be accepted
+    double weight{0.};                             ///< Function value at the trial point
+    const double* coordinates{nullptr};            ///< Phase space coordinates of the trial point
+  };
+  std::vector<Trial> trials_;          ///< Batch of unweighting trials
+  size_t next_trial_{0};               ///< Index of the next trial to be consumed
+  std::vector<size_t> selected_bins_;  ///< Bins drawn for all trials of the batch
+  std::vector<double> trial_points_;   ///< Flattened phase space points of all trials of the batch
+  std::vector<double> trial_weights_;  ///< Function values of all trials of the batch
 };
 REGISTER_GENERATOR_WORKER("grid_optimised", GridOptimisedGeneratorWorker);
@@ -60,7 +60,8 @@ Hist1D::Hist1D(const Hist1D& oth)
       hist_(gsl_histogram_clone(oth.hist_.get())),
       hist_w2_(gsl_histogram_clone(oth.hist_w2_.get())),
       underflow_(oth.underflow_),
-      overflow_(oth.overflow_) {}
+      overflow_(oth.overflow_),
+      inv_bin_width_(oth.inv_bin_width_) {}
 
 ParametersDescription Hist1D::description() {
   auto desc = ParametersDescription();
@@ -83,6 +84,7 @@ void Hist1D::buildFromBins(const std::vector<double>& bins) {
     throw CG_ERROR("Hist1D:buildFromBins") << gsl_strerror(ret);
   hist_w2_ = gsl_histogram_ptr(gsl_histogram_clone(hist_.get()));
   CG_ASSERT(hist_w2_);
+  inv_bin_width_ = 0.;  // bins are located by a binary search
   CG_DEBUG("Hist1D:buildFromBins") << "Booking a 1D histogram with " << s("bin", bins.size(), true) << " in range "
                                    << bins << ".";
 }
@@ -98,6 +100,7 @@ void Hist1D::buildFromRange(size_t num_bins, const Limits& range) {
     throw CG_ERROR("Hist1D:buildFromRange") << gsl_strerror(ret);
   hist_w2_ = gsl_histogram_ptr(gsl_histogram_clone(hist_.get()));
   CG_ASSERT(hist_w2_);
+  inv_bin_width_ = num_bins / range.range();  // bins are located arithmetically
   CG_DEBUG("Hist1D:buildFromRange") << "Booking a 1D histogram with " << s("bin", num_bins, true) << " in range "
                                     << range << ".";
 }
@@ -114,15 +117,10 @@ void Hist1D::clear() {
 void Hist1D::fill(double x, double weight) {
   CG_ASSERT(hist_);
   CG_ASSERT(hist_w2_);
-  {  // reduce the scope of 'ret'
-    auto ret = gsl_histogram_accumulate(hist_.get(), x, weight);
-    if (ret == GSL_SUCCESS) {
-      if (auto ret2 = gsl_histogram_accumulate(hist_w2_.get(), x, weight * weight) != GSL_SUCCESS)
-        throw CG_ERROR("Hist1D:fill") << "(w2 histogram): " << gsl_strerror(ret2);
-      return;
-    }
-    if (ret != GSL_EDOM)
-      throw CG_ERROR("Hist1D:fill") << gsl_strerror(ret);
+  if (size_t bin_id; findBin(x, bin_id)) {  // both histograms share the same binning
+    hist_->bin[bin_id] += weight;
+    hist_w2_->bin[bin_id] += weight * weight;
+    return;
   }
   if (x < range().min())
     underflow_ += weight;
@@ -149,6 +147,18 @@ void Hist1D::add(Hist1D oth, double scaling) {
   overflow_ += oth.overflow_;
 }
 
+void Hist1D::merge(const Hist1D& oth) {
+  CG_ASSERT(hist_);
+  CG_ASSERT(hist_w2_);
+  CG_ASSERT(oth.hist_);
+  CG_ASSERT(oth.hist_w2_);
+  if (auto ret = gsl_histogram_add(hist_.get(), oth.hist_.get()); ret != GSL_SUCCESS)
+    throw CG_ERROR("Hist1D:merge") << "Failed to merge histograms: " << gsl_strerror(ret);
+  gsl_histogram_add(hist_w2_.get(), oth.hist_w2_.get());
+  underflow_ += oth.underflow_;
+  overflow_ += oth.overflow_;
+}
+
 void Hist1D::scale(double scaling) {
   CG_ASSERT(hist_);
   if (auto ret = gsl_histogram_scale(hist_.get(), scaling); ret != GSL_SUCCESS)
@@ -193,11 +203,18 @@ std::vector<double> Hist1D::bins(BinMode mode) const {
 
 size_t Hist1D::bin(double x) const {
   size_t bin_id;
-  if (const auto ret = gsl_histogram_find(hist_.get(), x, &bin_id); ret != GSL_SUCCESS)
-    throw CG_ERROR("Hist1D:bin") << "Failed to retrieve bin index for value " << x << ": " << gsl_strerror(ret);
+  if (!findBin(x, bin_id))
+    throw CG_ERROR("Hist1D:bin") << "Failed to retrieve bin index for value " << x << ": out of range.";
   return bin_id;
 }
 
+bool Hist1D::findBin(double x, size_t& bin_id) const {
+  CG_ASSERT(hist_);
+  if (inv_bin_width_ > 0.)
+    return findUniformBin(hist_->range, hist_->n, inv_bin_width_, x, bin_id);
+  return gsl_histogram_find(hist_.get(), x, &bin_id) == GSL_SUCCESS;
+}
+
 std::vector<Value> Hist1D::values() const {
   std::vector<Value> values;
   for (size_t i = 0; i < nbins(); ++i)
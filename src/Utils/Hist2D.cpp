@@ -70,7 +70,9 @@ Hist2D::Hist2D(const Hist2D& oth)
       Drawable(oth),
       hist_(gsl_histogram2d_clone(oth.hist_.get())),
       hist_w2_(gsl_histogram2d_clone(oth.hist_w2_.get())),
-      out_of_range_values_(oth.out_of_range_values_) {}
+      out_of_range_values_(oth.out_of_range_values_),
+      inv_bin_width_x_(oth.inv_bin_width_x_),
+      inv_bin_width_y_(oth.inv_bin_width_y_) {}
 
 ParametersDescription Hist2D::description() {
   auto desc = Hist1D::description();
@@ -91,6 +93,7 @@ void Hist2D::buildFromBins(const std::vector<double>& x_bins, const std::vector<
     throw CG_ERROR("Hist2D:buildFromBins") << gsl_strerror(ret);
   hist_w2_ = gsl_histogram2d_ptr(gsl_histogram2d_clone(hist_.get()));
   CG_ASSERT(hist_w2_);
+  inv_bin_width_x_ = inv_bin_width_y_ = 0.;  // bins are located by a binary search
   CG_DEBUG("Hist2D:buildFromBins") << "Booking a 2D correlation plot with " << s("bin", x_bins.size(), true)
                                    << " in range x=" << x_bins << " and " << s("bin", y_bins.size(), true)
                                    << " in range y=" << y_bins << ".";
@@ -109,6 +112,7 @@ void Hist2D::buildFromRange(size_t num_bins_x, const Limits& xrange, size_t num_
     throw CG_ERROR("Hist2D:buildFromRange") << gsl_strerror(ret);
   hist_w2_ = gsl_histogram2d_ptr(gsl_histogram2d_clone(hist_.get()));
   CG_ASSERT(hist_w2_);
+  inv_bin_width_x_ = num_bins_x / xrange.range(), inv_bin_width_y_ = num_bins_y / y_range.range();
   CG_DEBUG("Hist2D:buildFromRange") << "Booking a 2D correlation plot with " << s("bin", num_bins_x, true)
                                     << " in range " << xrange << " and " << s("bin", num_bins_y, true) << " in range "
                                     << y_range << ".";
@@ -126,14 +130,11 @@ void Hist2D::clear() {
 void Hist2D::fill(double x, double y, double weight) {
   CG_ASSERT(hist_);
   CG_ASSERT(hist_w2_);
-  {  // reduce the scope of 'ret'
-    auto ret = gsl_histogram2d_accumulate(hist_.get(), x, y, weight);
-    if (ret == GSL_SUCCESS) {
-      gsl_histogram2d_accumulate(hist_w2_.get(), x, y, weight * weight);
-      return;
-    }
-    if (ret != GSL_EDOM)
-      throw CG_ERROR("Hist2D:fill") << gsl_strerror(ret);
+  if (size_t bin_x, bin_y; findBin(x, y, bin_x, bin_y)) {  // both histograms share the same binning
+    const auto bin_id = bin_x * hist_->ny + bin_y;
+    hist_->bin[bin_id] += weight;
+    hist_w2_->bin[bin_id] += weight * weight;
+    return;
   }
   const auto &x_range = rangeX(), &y_range = rangeY();
   if (x_range.contains(x)) {
@@ -176,6 +177,17 @@ void Hist2D::add(Hist2D oth, double scaling) {
   out_of_range_values_ += scaling * oth.out_of_range_values_;
 }
 
+void Hist2D::merge(const Hist2D& oth) {
+  CG_ASSERT(hist_);
+  CG_ASSERT(hist_w2_);
+  CG_ASSERT(oth.hist_);
+  CG_ASSERT(oth.hist_w2_);
+  if (auto ret = gsl_histogram2d_add(hist_.get(), oth.hist_.get()); ret != GSL_SUCCESS)
+    throw CG_ERROR("Hist2D:merge") << "Failed to merge histograms: " << gsl_strerror(ret);
+  gsl_histogram2d_add(hist_w2_.get(), oth.hist_w2_.get());
+  out_of_range_values_ += oth.out_of_range_values_;
+}
+
 void Hist2D::scale(double scaling) {
   CG_ASSERT(hist_);
   if (const auto ret = gsl_histogram2d_scale(hist_.get(), scaling); ret != GSL_SUCCESS)
@@ -231,12 +243,20 @@ std::vector<double> Hist2D::binsY(BinMode mode) const {
 
 std::pair<size_t, size_t> Hist2D::bin(double x, double y) const {
   std::pair<size_t, size_t> bin_ids;
-  if (const auto ret = gsl_histogram2d_find(hist_.get(), x, y, &bin_ids.first, &bin_ids.second); ret != GSL_SUCCESS)
+  if (!findBin(x, y, bin_ids.first, bin_ids.second))
     throw CG_ERROR("Hist2D:bin") << "Failed to retrieve bin index for values (" << x << ", " << y
-                                 << "): " << gsl_strerror(ret);
+                                 << "): out of range.";
   return bin_ids;
 }
 
+bool Hist2D::findBin(double x, double y, size_t& bin_x, size_t& bin_y) const {
+  CG_ASSERT(hist_);
+  if (inv_bin_width_x_ > 0. && inv_bin_width_y_ > 0.)
+    return findUniformBin(hist_->xrange, hist_->nx, inv_bin_width_x_, x, bin_x) &&
+           findUniformBin(hist_->yrange, hist_->ny, inv_bin_width_y_, y, bin_y);
+  return gsl_histogram2d_find(hist_.get(), x, y, &bin_x, &bin_y) == GSL_SUCCESS;
+}
+
 Value Hist2D::value(size_t bin_x, size_t bin_y) const {
   CG_ASSERT(hist_);
   return Value{gsl_histogram2d_get(hist_.get(), bin_x, bin_y),
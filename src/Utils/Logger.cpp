@@ -35,6 +35,16 @@ Logger& Logger::get(std::ostream* os) {
 
 void Logger::addExceptionRule(const std::string& rule) {
   allowed_exc_.emplace_back(rule, std::regex_constants::extended);
+  ++generation_;  // invalidate all call sites caches
+}
+
+void Logger::setLevel(Level level) {
+#ifdef CEPGEN_NO_DEBUG_LOOP
+  if (level >= Level::debugInsideLoop)
+    CG_WARNING("Logger") << "In-loop debugging messages were stripped from this build.";
+#endif
+  level_ = level;
+  ++generation_;  // invalidate all call sites caches
 }
 
 bool Logger::passExceptionRule(const std::string& tmpl, const Level& lev) const {
@@ -52,6 +62,19 @@ bool Logger::passExceptionRule(const std::string& tmpl, const Level& lev) const
   return false;
 }
 
+bool Logger::updateCallSite(const std::string& tmpl, const Level& lev, CallSite& site, bool constant_module) const {
+  const auto generation = generation_.load(std::memory_order_relaxed);
+  if (level_ >= lev || allowed_exc_.empty()) {  // decision independent of the module name
+    const bool pass = level_ >= lev;
+    site.state.store(generation << 1 | pass, std::memory_order_relaxed);
+    return pass;
+  }
+  const bool pass = passExceptionRule(tmpl, lev);
+  if (constant_module)
+    site.state.store(generation << 1 | pass, std::memory_order_relaxed);
+  return pass;
+}
+
 void Logger::setOutput(std::ostream* os) { output_.reset(os); }
 
 Logger::StreamHandler& Logger::output() {
@@ -0,0 +1,54 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Utils/MappedFile.h"
+
+using namespace cepgen::utils;
+
+MappedFile::MappedFile(const std::string& path) : path_(path) {
+  const auto fd = ::open(path_.data(), O_RDONLY);
+  if (fd < 0)
+    throw CG_FATAL("MappedFile") << "Failed to open file '" << path_ << "' for mapping: " << std::strerror(errno)
+                                 << ".";
+  struct stat st;
+  if (::fstat(fd, &st) < 0 || st.st_size <= 0) {
+    ::close(fd);
+    throw CG_FATAL("MappedFile") << "Failed to retrieve a valid size for file '" << path_ << "'.";
+  }
+  size_ = st.st_size;
+  auto* addr = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);  // the mapping remains valid after the file descriptor is closed
+  if (addr == MAP_FAILED)
+    throw CG_FATAL("MappedFile") << "Failed to map file '" << path_ << "': " << std::strerror(errno) << ".";
+  data_ = static_cast<const char*>(addr);
+  CG_DEBUG("MappedFile") << "File '" << path_ << "' mapped in memory (" << size_ << " bytes).";
+}
+
+MappedFile::~MappedFile() {
+  if (data_)
+    ::munmap(const_cast<char*>(data_), size_);
+}
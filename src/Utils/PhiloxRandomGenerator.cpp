@@ -0,0 +1,116 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Modules/RandomGeneratorFactory.h"
+#include "CepGen/Utils/RandomGenerator.h"
+
+using namespace cepgen;
+
+/// Counter-based Philox4x32-10 random number generator (Salmon et al., SC'11)
+/// \note The n-th number of a stream is a pure function of the seed, the stream index and n. Streams are therefore
+///  built in constant time, and the sequence of numbers does not depend on how the draws are partitioned.
+class PhiloxRandomGenerator final : public utils::RandomGenerator {
+public:
+  explicit PhiloxRandomGenerator(const ParametersList& params) : RandomGenerator(params) {
+    const auto seed = seed_ > 0ull ? seed_ : (static_cast<unsigned long long>(std::random_device{}()) << 32) ^
+                                                 std::random_device{}();
+    const auto stream = steer<unsigned long long>("stream");
+    key_ = {static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)};
+    counter_ = {0u, 0u, static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)};
+    CG_DEBUG("PhiloxRandomGenerator") << "Random numbers generator with seed: " << seed << ", stream: " << stream
+                                      << ".";
+  }
+
+  static ParametersDescription description() {
+    auto desc = RandomGenerator::description();
+    desc.setDescription("Philox4x32-10 counter-based random number generator");
+    desc.addAs<unsigned long long>("stream", 0ull)
+        .setDescription("index of the independent random numbers stream for this seed (e.g. a thread or job index)");
+    return desc;
+  }
+
+  int uniformInt(int min, int max) override {
+    const auto range = static_cast<double>(max) - min + 1.;
+    return std::min(max, static_cast<int>(std::floor(min + next() * range)));
+  }
+  double uniform(double min, double max) override { return min + (max - min) * next(); }
+  void fillUniform(double* values, size_t num_values, double min, double max) override {
+    const auto range = max - min;
+    size_t i = 0;
+    for (; i < num_values && index_ < NUM_BLOCK_VALUES; ++i)  // first consume the values left in the current block
+      values[i] = min + range * next();
+    for (; i + NUM_BLOCK_VALUES <= num_values; i += NUM_BLOCK_VALUES) {  // then generate full blocks directly
+      const auto block = generateBlock();
+      for (size_t j = 0; j < NUM_BLOCK_VALUES; ++j)
+        values[i + j] = min + range * toDouble(block, j);
+    }
+    for (; i < num_values; ++i)
+      values[i] = min + range * next();
+  }
+  double normal(double mean, double rms) override {  // Box-Muller transform
+    const auto radius = std::sqrt(-2. * std::log1p(-next())), angle = 2. * M_PI * next();
+    return mean + rms * radius * std::cos(angle);
+  }
+  double exponential(double exponent) override { return -std::log1p(-next()) / exponent; }
+  double breitWigner(double mean, double scale) override { return mean + scale * std::tan(M_PI * (next() - 0.5)); }
+
+private:
+  using block_t = std::array<uint32_t, 4>;
+  static constexpr size_t NUM_BLOCK_VALUES = 2;  ///< Number of (53-bit mantissa) doubles built from one block
+
+  /// Compute the block of random bits associated to the current counter, and increment the latter
+  block_t generateBlock() {
+    block_t block = counter_;
+    auto key = key_;
+    for (size_t round = 0; round < 10; ++round) {
+      const auto prod0 = static_cast<uint64_t>(0xd2511f53u) * block[0],
+                 prod1 = static_cast<uint64_t>(0xcd9e8d57u) * block[2];
+      block = {static_cast<uint32_t>(prod1 >> 32) ^ block[1] ^ key[0],
+               static_cast<uint32_t>(prod1),
+               static_cast<uint32_t>(prod0 >> 32) ^ block[3] ^ key[1],
+               static_cast<uint32_t>(prod0)};
+      key[0] += 0x9e3779b9u, key[1] += 0xbb67ae85u;  // Weyl sequence for the key schedule
+    }
+    if (++counter_[0] == 0u)  // 64-bit position within the stream
+      ++counter_[1];
+    return block;
+  }
+  /// Convert two 32-bit words of a block into a double in [0, 1)
+  static inline double toDouble(const block_t& block, size_t i) {
+    const auto word = (static_cast<uint64_t>(block[2 * i + 1]) << 32) | block[2 * i];
+    return (word >> 11) * 0x1.0p-53;
+  }
+  /// Next uniformly distributed number in [0, 1)
+  inline double next() {
+    if (index_ >= NUM_BLOCK_VALUES)
+      block_ = generateBlock(), index_ = 0;
+    return toDouble(block_, index_++);
+  }
+
+  std::array<uint32_t, 2> key_{};   ///< Generator key (seed)
+  block_t counter_{};               ///< Generator counter (position within the stream, and stream index)
+  block_t block_{};                 ///< Current block of random bits
+  size_t index_{NUM_BLOCK_VALUES};  ///< Index of the next value to be used in the current block
+};
+REGISTER_RANDOM_GENERATOR("philox", PhiloxRandomGenerator);
@@ -25,6 +25,11 @@ using namespace cepgen::utils;
 RandomGenerator::RandomGenerator(const ParametersList& params)
     : NamedModule(params), seed_(steer<unsigned long long>("seed")) {}
 
+void RandomGenerator::fillUniform(double* values, size_t num_values, double min, double max) {
+  for (size_t i = 0; i < num_values; ++i)
+    values[i] = uniform(min, max);
+}
+
 double RandomGenerator::exponential(double /*exponent*/) {
   CG_WARNING("RandomGenerator:exponential")
       << "Exponential distribution not implemented for this random number generator.";
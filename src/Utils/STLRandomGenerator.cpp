@@ -16,6 +16,7 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <memory>
 #include <random>
 
@@ -79,6 +80,9 @@ public:
 
   int uniformInt(int min, int max) override { return gen_->uniformInt(min, max); }
   double uniform(double min, double max) override { return gen_->uniform(min, max); }
+  void fillUniform(double* values, size_t num_values, double min, double max) override {
+    gen_->fillUniform(values, num_values, min, max);
+  }
   double normal(double mean, double rms) override { return gen_->normal(mean, rms); }
   double exponential(double exponent) override { return gen_->exponential(exponent); }
   double breitWigner(double mean, double scale) override { return gen_->breitWigner(mean, scale); }
@@ -91,6 +95,10 @@ private:
     explicit Generator(unsigned long int value) : RandomGenerator(ParametersList()), rng_(value) {}
     int uniformInt(int min, int max) override { return std::uniform_int_distribution<>(min, max)(rng_); }
     double uniform(double min, double max) override { return std::uniform_real_distribution<>(min, max)(rng_); }
+    void fillUniform(double* values, size_t num_values, double min, double max) override {
+      std::uniform_real_distribution<> distribution(min, max);  // only built once for the whole batch
+      std::generate(values, values + num_values, [this, &distribution]() { return distribution(rng_); });
+    }
     double normal(double mean, double rms) override { return std::normal_distribution<>(mean, rms)(rng_); }
     double exponential(double exponent) override { return std::exponential_distribution<>(exponent)(rng_); }
     double breitWigner(double mean, double scale) override { return std::cauchy_distribution<>(mean, scale)(rng_); }
@@ -0,0 +1,114 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <unistd.h>
+
+#include <cstring>
+#include <fstream>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/String.h"
+#include "CepGen/Utils/TableCache.h"
+
+using namespace cepgen::utils;
+
+static constexpr char kMagic[] = "CGTABL01";  ///< File format identifier
+
+namespace {
+  /// 64-bit FNV-1a hash of a string, stable across platforms and runs
+  unsigned long long hash(const std::string& str) {
+    unsigned long long out = 0xcbf29ce484222325ull;
+    for (const auto& chr : str)
+      out = (out ^ static_cast<unsigned char>(chr)) * 0x100000001b3ull;
+    return out;
+  }
+}  // namespace
+
+TableCache::TableCache(const std::string& path, const std::string& name, const std::string& configuration)
+    : path_(path),
+      configuration_(configuration),
+      filename_((fs::path(path_) / format("cepgen_%s_%016llx.bin", name.data(), hash(configuration_))).string()) {
+  CG_DEBUG("TableCache") << "Table cache file for this configuration: '" << filename_ << "'.\n\t"
+                         << "Configuration: " << configuration_ << ".";
+}
+
+bool TableCache::load(std::vector<double>& values) const {
+  std::ifstream file(filename_, std::ios::binary);
+  if (!file.good()) {
+    CG_DEBUG("TableCache:load") << "No table cache file found at '" << filename_ << "'.";
+    return false;
+  }
+  const auto file_size = static_cast<unsigned long long>(file.seekg(0, std::ios::end).tellg());
+  file.seekg(0);
+  char magic[sizeof(kMagic)];
+  unsigned long long configuration_size, num_values;
+  if (!file.read(magic, sizeof(kMagic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+      !file.read(reinterpret_cast<char*>(&configuration_size), sizeof(configuration_size))) {
+    CG_WARNING("TableCache:load") << "Invalid table cache file '" << filename_ << "'. It will be overwritten.";
+    return false;
+  }
+  // sizes read from the file are only trusted if consistent with the expected configuration and the file size
+  std::string configuration;
+  if (configuration_size == configuration_.size()) {
+    configuration.resize(configuration_size);
+    file.read(configuration.data(), configuration_size);
+  }
+  if (!file || configuration != configuration_) {
+    CG_WARNING("TableCache:load") << "Table cache file '" << filename_ << "' was produced for another "
+                                  << "configuration. It will be overwritten.";
+    return false;
+  }
+  std::vector<double> buffer;
+  if (file.read(reinterpret_cast<char*>(&num_values), sizeof(num_values)) &&
+      num_values <= (file_size - static_cast<unsigned long long>(file.tellg())) / sizeof(double)) {
+    buffer.resize(num_values);
+    file.read(reinterpret_cast<char*>(buffer.data()), num_values * sizeof(double));
+  } else
+    file.setstate(std::ios::failbit);
+  if (!file) {
+    CG_WARNING("TableCache:load") << "Corrupted table cache file '" << filename_ << "'. It will be overwritten.";
+    return false;
+  }
+  values = std::move(buffer);
+  CG_DEBUG("TableCache:load") << "Table retrieved from cache file '" << filename_ << "'.";
+  return true;
+}
+
+void TableCache::store(const std::vector<double>& values) const {
+  if (std::error_code err; !fs::create_directories(path_, err) && err)
+    throw CG_FATAL("TableCache:store") << "Failed to create the table cache directory '" << path_
+                                       << "': " << err.message() << ".";
+  // write into a process-specific temporary file before moving it to its final destination, so that concurrent jobs
+  // sharing the same cache directory never read a partially written file
+  const auto tmp_filename = filename_ + "." + std::to_string(::getpid());
+  {
+    std::ofstream file(tmp_filename, std::ios::binary | std::ios::trunc);
+    if (!file.good())
+      throw CG_FATAL("TableCache:store") << "Failed to open the table cache file '" << tmp_filename
+                                         << "' for writing.";
+    const unsigned long long configuration_size = configuration_.size(), num_values = values.size();
+    file.write(kMagic, sizeof(kMagic));
+    file.write(reinterpret_cast<const char*>(&configuration_size), sizeof(configuration_size));
+    file.write(configuration_.data(), configuration_size);
+    file.write(reinterpret_cast<const char*>(&num_values), sizeof(num_values));
+    file.write(reinterpret_cast<const char*>(values.data()), num_values * sizeof(double));
+  }
+  fs::rename(tmp_filename, filename_);
+  CG_DEBUG("TableCache:store") << "Table stored into cache file '" << filename_ << "'.";
+}
@@ -16,6 +16,8 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <sstream>
 
@@ -24,57 +26,197 @@
 
 using namespace cepgen::utils;
 
+TimeKeeper::TimeKeeper(bool with_histograms)
+    : id_([] {
+        static std::atomic<unsigned long long> num_instances{0};
+        return ++num_instances;
+      }()),
+      with_histograms_(with_histograms) {}
+
 void TimeKeeper::clear() {
-  monitors_.clear();
+  const std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& [thread_id, thread_monitors] : thread_monitors_) {
+    const std::lock_guard<std::mutex> thread_lock(thread_monitors->mutex);
+    thread_monitors->monitors.clear();
+  }
   tmr_.reset();
 }
 
+bool TimeKeeper::empty() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& [thread_id, thread_monitors] : thread_monitors_) {
+    const std::lock_guard<std::mutex> thread_lock(thread_monitors->mutex);
+    if (!thread_monitors->monitors.empty())
+      return false;
+  }
+  return true;
+}
+
 TimeKeeper& TimeKeeper::tick(const std::string& func, double time) {
-  monitors_[func].emplace_back(time > 0. ? time : tmr_.elapsed());
+  auto& local = localMonitors();
+  const std::lock_guard<std::mutex> lock(local.mutex);
+  auto it = local.monitors.find(func);
+  if (it == local.monitors.end())
+    it = local.monitors.emplace(func, Monitor(with_histograms_)).first;
+  it->second.fill(time > 0. ? time : tmr_.elapsed());
+  return *this;
+}
+
+TimeKeeper::ThreadMonitors& TimeKeeper::localMonitors() {
+  // single-entry cache to avoid a registry lookup (and its lock) for each tick
+  thread_local struct {
+    unsigned long long owner{0};
+    ThreadMonitors* monitors{nullptr};
+  } cache;
+  if (cache.owner != id_ || !cache.monitors) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    auto& thread_monitors = thread_monitors_[std::this_thread::get_id()];
+    if (!thread_monitors)
+      thread_monitors = std::make_unique<ThreadMonitors>();
+    cache.owner = id_;
+    cache.monitors = thread_monitors.get();
+  }
+  return *cache.monitors;
+}
+
+std::map<std::string, TimeKeeper::Monitor> TimeKeeper::monitors() const {
+  std::map<std::string, Monitor> monitors;
+  const std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& [thread_id, thread_monitors] : thread_monitors_) {
+    const std::lock_guard<std::mutex> thread_lock(thread_monitors->mutex);
+    for (const auto& [name, monitor] : thread_monitors->monitors) {
+      if (auto it = monitors.find(name); it != monitors.end())
+        it->second += monitor;
+      else
+        monitors.emplace(name, monitor);
+    }
+  }
+  return monitors;
+}
+
+TimeKeeper& TimeKeeper::merge(const TimeKeeper& oth) {
+  if (&oth == this)
+    return *this;
+  const auto oth_monitors = oth.monitors();
+  auto& local = localMonitors();
+  const std::lock_guard<std::mutex> lock(local.mutex);
+  for (const auto& [name, monitor] : oth_monitors) {
+    if (auto it = local.monitors.find(name); it != local.monitors.end())
+      it->second += monitor;
+    else
+      local.monitors.emplace(name, monitor);
+  }
   return *this;
 }
 
+const Timer& TimeKeeper::timer() const { return tmr_; }
+
 std::string TimeKeeper::summary() const {
-  if (monitors_.empty())
+  const auto monitors = this->monitors();
+  if (monitors.empty())
     return {};
 
-  // a bit of arithmetics
-  struct Monitor {
-    std::string name;
-    size_t size;
-    double total, mean, rms;
-    bool operator<(const Monitor& oth) const { return total < oth.total; }
-  };
-
-  std::vector<Monitor> mons;
+  std::vector<std::pair<std::string, Monitor> > mons(monitors.begin(), monitors.end());
   double total_time = 0.;
-  for (const auto& mon : monitors_) {
-    const auto& tm = mon.second;
-    const double total = tm.empty() ? -1. : std::accumulate(tm.begin(), tm.end(), 0.);
-    const double mean = total / static_cast<double>(tm.size());
-    const double rms = std::sqrt(std::fabs(
-        std::inner_product(tm.begin(), tm.end(), tm.begin(), 0.) / static_cast<double>(tm.size()) - mean * mean));
-    mons.emplace_back(Monitor{mon.first, tm.size(), total, mean, rms});
-    total_time += total;
+  bool with_histograms = false;
+  for (const auto& mon : mons) {
+    total_time += mon.second.total();
+    with_histograms |= mon.second.hasHistogram();
   }
-
-  std::sort(mons.rbegin(), mons.rend());  // sort by total clock time (desc.)
+  // sort by total clock time (desc.)
+  std::sort(mons.begin(), mons.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.second.total() > rhs.second.total();
+  });
 
   // display the various probes
   static constexpr double s_to_ms = 1.e3;
   std::ostringstream oss;
   oss << format("%2s | %-100s | %12s\t%10s\t%5s", "#", "Caller", "Total (ms)", "Average (ms)", "RMS (ms)");
-  for (const auto& mon : mons)
+  if (with_histograms)
+    oss << format("\t%10s\t%10s", "p50 (ms)", "p99 (ms)");
+  for (const auto& [name, mon] : mons) {
     oss << format("\n%10u | %-100s | %12.6f\t%10e\t%5.3e",
-                  mon.size,
-                  mon.name.c_str(),
-                  mon.total * s_to_ms,
-                  mon.mean * s_to_ms,
-                  mon.rms * s_to_ms);
+                  mon.size(),
+                  name.c_str(),
+                  mon.total() * s_to_ms,
+                  mon.mean() * s_to_ms,
+                  mon.rms() * s_to_ms);
+    if (mon.hasHistogram())
+      oss << format("\t%10e\t%10e", mon.quantile(0.5) * s_to_ms, mon.quantile(0.99) * s_to_ms);
+  }
   oss << "\nTotal time: " << total_time << ".";
   return oss.str();
 }
 
+TimeKeeper::Monitor::Monitor(bool with_histogram) {
+  if (with_histogram)
+    histogram_.resize(kNumSubBins * kNumPowers, 0ull);
+}
+
+void TimeKeeper::Monitor::fill(double time) {
+  min_ = num_ == 0 ? time : std::min(min_, time);
+  max_ = num_ == 0 ? time : std::max(max_, time);
+  ++num_;
+  sum_ += time;
+  sum2_ += time * time;
+  if (!histogram_.empty())
+    ++histogram_[bin(time)];
+}
+
+TimeKeeper::Monitor& TimeKeeper::Monitor::operator+=(const Monitor& oth) {
+  if (oth.num_ == 0)
+    return *this;
+  min_ = num_ == 0 ? oth.min_ : std::min(min_, oth.min_);
+  max_ = num_ == 0 ? oth.max_ : std::max(max_, oth.max_);
+  num_ += oth.num_;
+  sum_ += oth.sum_;
+  sum2_ += oth.sum2_;
+  if (!oth.histogram_.empty()) {
+    if (histogram_.empty())
+      histogram_.resize(oth.histogram_.size(), 0ull);
+    for (size_t i = 0; i < histogram_.size(); ++i)
+      histogram_[i] += oth.histogram_[i];
+  }
+  return *this;
+}
+
+double TimeKeeper::Monitor::mean() const { return num_ > 0 ? sum_ / static_cast<double>(num_) : 0.; }
+
+double TimeKeeper::Monitor::rms() const {
+  if (num_ == 0)
+    return 0.;
+  const auto mean = this->mean();
+  return std::sqrt(std::fabs(sum2_ / static_cast<double>(num_) - mean * mean));
+}
+
+double TimeKeeper::Monitor::quantile(double q) const {
+  if (histogram_.empty() || num_ == 0)
+    return -1.;
+  const auto target = std::clamp(q, 0., 1.) * static_cast<double>(num_);
+  unsigned long long cumulant = 0ull;
+  for (size_t i = 0; i < histogram_.size(); ++i)
+    if (cumulant += histogram_.at(i); cumulant > 0ull && static_cast<double>(cumulant) >= target)
+      return std::clamp(binCentre(i), min_, max_);
+  return max_;
+}
+
+size_t TimeKeeper::Monitor::bin(double time) {
+  static constexpr double s_to_ns = 1.e9;
+  const auto time_ns = time * s_to_ns;
+  if (!(time_ns >= 1.))  // also catches NaN values
+    return 0;
+  int exponent;
+  const auto mantissa = std::frexp(time_ns, &exponent);  // time_ns = mantissa * 2^exponent, mantissa in [0.5, 1)
+  const auto sub_bin = static_cast<size_t>((2. * mantissa - 1.) * kNumSubBins);
+  return std::min(static_cast<size_t>(exponent - 1) * kNumSubBins + sub_bin, kNumSubBins * kNumPowers - 1);
+}
+
+double TimeKeeper::Monitor::binCentre(size_t bin) {
+  static constexpr double ns_to_s = 1.e-9;
+  const auto power = static_cast<int>(bin / kNumSubBins), sub_bin = static_cast<int>(bin % kNumSubBins);
+  return std::ldexp(1. + (sub_bin + 0.5) / kNumSubBins, power) * ns_to_s;
+}
+
 TimeKeeper::Ticker::Ticker(TimeKeeper* tk, const std::string& name) : tk_(tk), name_(name) {}
 
 TimeKeeper::Ticker::~Ticker() {
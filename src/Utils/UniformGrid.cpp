@@ -0,0 +1,290 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <sstream>
+#include <thread>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Core/ParametersDescription.h"
+#include "CepGen/Utils/String.h"
+#include "CepGen/Utils/TableCache.h"
+#include "CepGen/Utils/Timer.h"
+#include "CepGen/Utils/UniformGrid.h"
+
+using namespace cepgen;
+using namespace std::string_literals;
+
+template <size_t D, size_t N>
+UniformGrid<D, N>::UniformGrid(const std::array<Limits, D>& ranges,
+                               const std::array<size_t, D>& num_nodes,
+                               const GridType& grid_type)
+    : grid_type_(grid_type), ranges_(ranges), num_nodes_(num_nodes) {
+  size_t size = 1;
+  for (size_t d = D; d-- > 0;) {
+    if (num_nodes_[d] < 2)
+      throw CG_FATAL("UniformGrid") << "At least two nodes are required along dimension " << d << ", got "
+                                    << num_nodes_[d] << ".";
+    if (!ranges_[d].valid() || ranges_[d].range() <= 0. ||
+        (grid_type_ == GridType::logarithmic && ranges_[d].min() <= 0.))
+      throw CG_FATAL("UniformGrid") << "Invalid range for dimension " << d << ": " << ranges_[d] << ".";
+    min_[d] = transform(ranges_[d].min());
+    step_[d] = (transform(ranges_[d].max()) - min_[d]) / (num_nodes_[d] - 1);
+    strides_[d] = size;
+    size *= num_nodes_[d];
+  }
+  values_.assign(size, values_t{});
+}
+
+template <size_t D, size_t N>
+bool UniformGrid<D, N>::contains(const coord_t& coord) const {
+  for (size_t d = 0; d < D; ++d)
+    if (!ranges_[d].contains(coord[d]))
+      return false;
+  return true;
+}
+
+template <size_t D, size_t N>
+typename UniformGrid<D, N>::coord_t UniformGrid<D, N>::node(size_t index) const {
+  if (index >= size())
+    throw CG_FATAL("UniformGrid:node") << "Invalid node index: " << index << " >= " << size() << ".";
+  coord_t coord;
+  for (size_t d = D; d-- > 0; index /= num_nodes_[d])
+    coord[d] = inverseTransform(min_[d] + (index % num_nodes_[d]) * step_[d]);
+  return coord;
+}
+
+template <size_t D, size_t N>
+std::vector<double> UniformGrid<D, N>::serialise() const {
+  std::vector<double> out;
+  out.reserve(size() * N);
+  for (const auto& value : values_)
+    out.insert(out.end(), value.begin(), value.end());
+  return out;
+}
+
+template <size_t D, size_t N>
+bool UniformGrid<D, N>::deserialise(const std::vector<double>& values) {
+  if (values.size() != size() * N)
+    return false;
+  for (size_t i = 0; i < size(); ++i)
+    std::copy(values.begin() + i * N, values.begin() + (i + 1) * N, values_[i].begin());
+  return true;
+}
+
+template <size_t D, size_t N>
+size_t UniformGrid<D, N>::fill(const std::function<Function()>& function_builder, size_t num_threads) {
+  num_threads = std::min<size_t>(num_threads > 0 ? num_threads : std::max(std::thread::hardware_concurrency(), 1u),
+                                 size());
+  std::vector<Function> functions;  // built sequentially, in the current thread
+  for (size_t i = 0; i < num_threads; ++i)
+    functions.emplace_back(function_builder());
+  const auto fill_nodes = [this, &num_threads, &functions](size_t thread_id) {
+    for (size_t i = thread_id; i < size(); i += num_threads)  // interleaved nodes for load balancing
+      values_[i] = functions[thread_id](node(i));
+  };
+  std::vector<std::future<void> > jobs;
+  for (size_t i = 1; i < num_threads; ++i)
+    jobs.emplace_back(std::async(std::launch::async, fill_nodes, i));
+  fill_nodes(0);  // first nodes subset is computed in the current thread
+  for (auto& job : jobs)
+    job.get();  // wait for all threads, and propagate any exception raised while computing the values
+  return num_threads;
+}
+
+template <size_t D, size_t N>
+typename UniformGrid<D, N>::values_t UniformGrid<D, N>::maxRelativeDeviation(
+    const Function& function, size_t num_checks, const std::vector<size_t>& norm_indices) const {
+  if (!norm_indices.empty() && norm_indices.size() != N)
+    throw CG_FATAL("UniformGrid:maxRelativeDeviation")
+        << "Invalid normalisation indices multiplicity: " << norm_indices.size() << " != " << N << ".";
+  const auto num_cells = numCells();
+  values_t max_deviation{};
+  for (size_t i = 0; i < std::min(num_checks, num_cells); ++i) {
+    coord_t centre;
+    for (size_t d = D, cell = (i * 7919ul) % num_cells; d-- > 0; cell /= num_nodes_[d] - 1)  // prime stride scan
+      centre[d] = inverseTransform(min_[d] + (cell % (num_nodes_[d] - 1) + 0.5) * step_[d]);
+    const auto exact = function(centre), interpolated = eval(centre);
+    for (size_t j = 0; j < N; ++j)
+      if (const auto norm = std::fabs(exact[norm_indices.empty() ? j : norm_indices[j]]); norm > 0.)
+        max_deviation[j] = std::max(max_deviation[j], std::fabs(interpolated[j] - exact[j]) / norm);
+  }
+  return max_deviation;
+}
+
+template <size_t D, size_t N>
+void UniformGrid<D, N>::buildCached(const std::string& name,
+                                    const std::string& configuration,
+                                    const std::function<Function()>& function_builder,
+                                    const ParametersList& params,
+                                    const std::vector<size_t>& norm_indices) {
+  const utils::Timer tmr;
+  std::unique_ptr<utils::TableCache> cache;
+  if (const auto& cache_path = params.get<std::string>("cachePath"); !cache_path.empty())
+    cache = std::make_unique<utils::TableCache>(cache_path, name, configuration);
+  if (std::vector<double> values; cache && cache->load(values) && deserialise(values)) {
+    CG_DEBUG("UniformGrid:buildCached") << "Table '" << name << "' retrieved from cache file '" << cache->filename()
+                                        << "'.";
+    return;
+  }
+  const auto num_threads = fill(function_builder, std::max(params.get<int>("numThreads"), 0));
+  if (cache)
+    cache->store(serialise());
+  CG_INFO("UniformGrid:buildCached") << "Table '" << name << "' with " << size() << " nodes computed over "
+                                     << utils::s("thread", num_threads, true) << " in " << tmr.elapsed() << " s.";
+  if (const auto num_checks = params.get<int>("numAccuracyChecks"); num_checks > 0) {
+    const auto max_deviation = maxRelativeDeviation(function_builder(), num_checks, norm_indices);
+    const auto tolerance = params.get<double>("tolerance");
+    std::ostringstream os;
+    os << "Maximal relative deviations of the table '" << name << "' interpolated values over "
+       << utils::s("cell centre", std::min<size_t>(num_checks, numCells()), true) << ": "
+       << utils::repr(std::vector<double>(max_deviation.begin(), max_deviation.end()), ", ")
+       << " (tolerance: " << tolerance << ").";
+    if (*std::max_element(max_deviation.begin(), max_deviation.end()) > tolerance)
+      CG_WARNING("UniformGrid:buildCached") << os.str();
+    else
+      CG_INFO("UniformGrid:buildCached") << os.str();
+  }
+}
+
+template <size_t D, size_t N>
+ParametersDescription UniformGrid<D, N>::cachingDescription(int num_accuracy_checks, double tolerance) {
+  ParametersDescription desc;
+  desc.add("numThreads", 0).setDescription("number of threads used to fill the table (0 for all available cores)");
+  desc.add("cachePath", ""s).setDescription("directory where the table is cached across runs (empty to disable)");
+  desc.add("numAccuracyChecks", num_accuracy_checks)
+      .setDescription("number of table cells probed to estimate the interpolation accuracy");
+  desc.add("tolerance", tolerance).setDescription("maximal relative interpolation deviation tolerated before warning");
+  return desc;
+}
+
+template <size_t D, size_t N>
+typename UniformGrid<D, N>::values_t UniformGrid<D, N>::eval(const coord_t& coord) const {
+  // per-dimension stencil offsets and Catmull-Rom weights
+  std::array<std::array<size_t, 4>, D> offsets;
+  std::array<std::array<double, 4>, D> weights;
+  for (size_t d = 0; d < D; ++d) {
+    catmullRomStencil((transform(coord[d]) - min_[d]) / step_[d], num_nodes_[d], offsets[d], weights[d]);
+    for (auto& offset : offsets[d])
+      offset *= strides_[d];
+  }
+  values_t out{};
+  for (size_t k = 0; k < (1ul << (2 * D)); ++k) {  // loop over all 4^D stencil nodes
+    double weight = 1.;
+    size_t offset = 0;
+    for (size_t d = 0, kk = k; d < D; ++d, kk >>= 2) {
+      weight *= weights[d][kk & 3];
+      offset += offsets[d][kk & 3];
+    }
+    const auto& value = values_[offset];
+    for (size_t i = 0; i < N; ++i)
+      out[i] += weight * value[i];
+  }
+  return out;
+}
+
+namespace {
+  /// Cubic Hermite weights in a cell, with node derivatives estimated from the neighbours' finite differences
+  /// \param[in] ratio_low Ratio of the cell width to the distance between the neighbours of its lower node
+  /// \param[in] ratio_high Ratio of the cell width to the distance between the neighbours of its upper node
+  void stencil(size_t cell,
+               double t,
+               size_t num_nodes,
+               double ratio_low,
+               double ratio_high,
+               std::array<size_t, 4>& nodes,
+               std::array<double, 4>& weights) {
+    const auto t2 = t * t, t3 = t2 * t;
+    const auto h00 = 2. * t3 - 3. * t2 + 1., h10 = t3 - 2. * t2 + t, h01 = 3. * t2 - 2. * t3, h11 = t3 - t2;
+    auto& w = weights;
+    w = {-ratio_low * h10, h00 - ratio_high * h11, h01 + ratio_low * h10, ratio_high * h11};
+    // in the first and last cells, the missing stencil node is linearly extrapolated from the two closest ones
+    // (f[-1] = 2 f[0] - f[1], resp. f[n] = 2 f[n-1] - f[n-2]), and its weight is folded into theirs
+    const double first = cell == 0, last = cell + 2 == num_nodes;
+    w[1] += 2. * first * w[0], w[2] -= first * w[0], w[0] *= 1. - first;
+    w[2] += 2. * last * w[3], w[1] -= last * w[3], w[3] *= 1. - last;
+    for (size_t k = 0; k < 4; ++k)  // stencil is clamped to the grid boundaries
+      nodes[k] = std::clamp<long long>(cell + k - 1ll, 0ll, num_nodes - 1ll);
+  }
+}  // namespace
+
+void cepgen::catmullRomStencil(double pos,
+                               size_t num_nodes,
+                               std::array<size_t, 4>& nodes,
+                               std::array<double, 4>& weights) {
+  const auto max_node = static_cast<double>(num_nodes - 1);
+  pos = std::clamp(pos, 0., max_node);
+  const auto cell = std::min(std::floor(pos), max_node - 1.);
+  stencil(static_cast<size_t>(cell), pos - cell, num_nodes, 0.5, 0.5, nodes, weights);
+}
+
+void cepgen::catmullRomStencil(const std::vector<double>& axis,
+                               double x,
+                               std::array<size_t, 4>& nodes,
+                               std::array<double, 4>& weights) {
+  const auto num_nodes = axis.size();
+  x = std::clamp(x, axis.front(), axis.back());
+  const auto cell =
+      std::min<size_t>(std::upper_bound(axis.begin() + 1, axis.end(), x) - axis.begin(), num_nodes - 1) - 1;
+  const auto low = axis[cell], high = axis[cell + 1], width = high - low;
+  // missing neighbours are linearly extrapolated, as for the nodes values
+  const auto before = cell > 0 ? axis[cell - 1] : 2. * low - high,
+             after = cell + 2 < num_nodes ? axis[cell + 2] : 2. * high - low;
+  stencil(cell, (x - low) / width, num_nodes, width / (high - before), width / (after - low), nodes, weights);
+}
+
+template <size_t D, size_t N>
+size_t UniformGrid<D, N>::numCells() const {
+  size_t num_cells = 1;
+  for (const auto& num_nodes : num_nodes_)
+    num_cells *= num_nodes - 1;
+  return num_cells;
+}
+
+template <size_t D, size_t N>
+double UniformGrid<D, N>::transform(double coord) const {
+  switch (grid_type_) {
+    case GridType::logarithmic:
+      return std::log10(coord);
+    case GridType::square:
+      return coord * coord;
+    default:
+      return coord;
+  }
+}
+
+template <size_t D, size_t N>
+double UniformGrid<D, N>::inverseTransform(double coord) const {
+  switch (grid_type_) {
+    case GridType::logarithmic:
+      return std::pow(10., coord);
+    case GridType::square:
+      return std::sqrt(coord);
+    default:
+      return coord;
+  }
+}
+
+namespace cepgen {  // template specialisation for the few cases handled
+  template class UniformGrid<1, 1>;
+  template class UniformGrid<1, 2>;
+  template class UniformGrid<2, 1>;
+  template class UniformGrid<2, 4>;
+}  // namespace cepgen
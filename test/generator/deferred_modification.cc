@@ -0,0 +1,112 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+
+#include "CepGen/Core/RunParameters.h"
+#include "CepGen/Event/Event.h"
+#include "CepGen/EventFilter/EventExporter.h"
+#include "CepGen/EventFilter/EventModifier.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/EventModifierFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+/// Event modification algorithm recording its calls, with a configurable veto and branching fraction
+class CountingModifier final : public cepgen::EventModifier {
+public:
+  explicit CountingModifier(const cepgen::ParametersList& params)
+      : EventModifier(params),
+        num_vetoes_(steer<int>("numVetoes")),
+        branching_ratio_(steer<double>("branchingRatio")) {}
+
+  static cepgen::ParametersDescription description() {
+    auto desc = EventModifier::description();
+    desc.setDescription("Counting event modifier");
+    desc.add("numVetoes", 0).setDescription("number of first modification calls to veto");
+    desc.add("branchingRatio", 1.).setDescription("branching fraction returned for each modified event");
+    return desc;
+  }
+
+  bool run(cepgen::Event& event, double& weight, bool fast) override {
+    if (fast)  // integration and generation grid preparation stages
+      return true;
+    last_weight = event.metadata(cepgen::Event::EventMetadata::Weight);
+    if (num_calls++ < static_cast<size_t>(num_vetoes_))
+      return false;
+    weight = branching_ratio_;
+    return true;
+  }
+
+  static inline atomic<size_t> num_calls{0};  ///< Number of calls during the events generation stage
+  static inline double last_weight{0.};       ///< Event weight before its last modification
+
+private:
+  const int num_vetoes_;
+  const double branching_ratio_;
+};
+REGISTER_MODIFIER("counting", CountingModifier);
+
+int main(int argc, char* argv[]) {
+  string input_card;
+  int num_events, num_attempts;
+
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("config,i", "path to the configuration file", &input_card, "Cards/lpair_cfg.py")
+      .addOptionalArgument("num-events,n", "number of events to generate", &num_events, 50)
+      .addOptionalArgument("num-attempts,a", "maximal number of modification attempts", &num_attempts, 3)
+      .parse();
+
+  // generate events with a single event modification algorithm, and count its calls
+  const auto generate = [&](bool defer, int num_vetoes, double branching_ratio) {
+    CountingModifier::num_calls = 0;
+    cepgen::Generator gen;
+    gen.parseRunParameters(input_card);
+    gen.runParameters().eventExportersSequence().clear();
+    gen.runParameters().clearEventModifiersSequence();
+    gen.runParameters().addModifier(cepgen::EventModifierFactory::get().build(
+        "counting", cepgen::ParametersList().set("numVetoes", num_vetoes).set("branchingRatio", branching_ratio)));
+    gen.runParameters().generation().setParameters(
+        cepgen::ParametersList().set("deferModification", defer).set("modificationAttempts", num_attempts));
+    size_t num_consistent_weights = 0;
+    gen.generate(num_events, [&num_consistent_weights, &branching_ratio](const cepgen::Event& event, size_t) {
+      num_consistent_weights += event.metadata(cepgen::Event::EventMetadata::Weight) ==
+                                CountingModifier::last_weight * branching_ratio;
+    });
+    return num_consistent_weights;
+  };
+
+  generate(false, 0, 1.);
+  CG_TEST(CountingModifier::num_calls > (size_t)num_events, "modifications of all trial events if not deferred");
+  generate(true, 0, 1.);
+  CG_TEST_EQUAL(CountingModifier::num_calls.load(), (size_t)num_events, "deferred modifications of accepted events");
+
+  generate(true, num_attempts - 1, 1.);  // first event is only modified at its last attempt
+  CG_TEST_EQUAL(
+      CountingModifier::num_calls.load(), (size_t)(num_events + num_attempts - 1), "event kept at its last attempt");
+  generate(true, num_attempts, 1.);  // first event is vetoed at all attempts, and discarded
+  CG_TEST_EQUAL(
+      CountingModifier::num_calls.load(), (size_t)(num_events + num_attempts), "event vetoed at all attempts");
+
+  CG_TEST_EQUAL(generate(true, 0, 0.5), (size_t)num_events, "branching fraction in the accepted events weight");
+  CG_TEST(CountingModifier::num_calls > (size_t)num_events, "accepted events kept with the branching fraction");
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,78 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fstream>
+
+#include "CepGen/Core/RunParameters.h"
+#include "CepGen/EventFilter/EventExporter.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  string input_card, cache_path;
+  int num_events;
+
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("config,i", "path to the configuration file", &input_card, "Cards/lpair_cfg.py")
+      .addOptionalArgument("num-events,n", "number of events to generate", &num_events, 10)
+      .addOptionalArgument(
+          "cache,c", "grids cache directory", &cache_path, (fs::temp_directory_path() / "cepgen_grid_cache").string())
+      .parse();
+
+  fs::remove_all(cache_path);
+
+  const auto run = [&](unsigned long long seed) {
+    cepgen::Generator gen;
+    gen.parseRunParameters(input_card);
+    gen.runParameters().eventExportersSequence().clear();
+    gen.runParameters().generation().setGridCache(cache_path);
+    auto worker_params = gen.runParameters().generation().parameters().get<cepgen::ParametersList>("worker");
+    // a different unweighting random numbers stream should not prevent the grids from being reused
+    worker_params.operator[]<cepgen::ParametersList>("randomGenerator").set("seed", seed);
+    gen.runParameters().generation().setParameters(cepgen::ParametersList().set("worker", worker_params));
+    gen.generate(num_events);
+    return std::make_pair(gen.crossSection(), gen.crossSectionError());
+  };
+
+  const auto first_run = run(42);
+  CG_TEST(!fs::is_empty(cache_path), "grids cache file created");
+  const auto second_run = run(43);
+  CG_TEST_EQUAL(first_run.first, second_run.first, "cross section retrieved from cache");
+  CG_TEST_EQUAL(first_run.second, second_run.second, "cross section uncertainty retrieved from cache");
+
+  // a corrupted cache file (here, with an unrealistic configuration size) is discarded without any allocation from its
+  // content, and overwritten with the newly computed grids
+  for (const auto& entry : fs::directory_iterator(cache_path)) {
+    std::ofstream file(entry.path(), std::ios::binary | std::ios::trunc);
+    const unsigned long long configuration_size = 1ull << 60;
+    file.write("CGGRID01", 9);
+    file.write(reinterpret_cast<const char*>(&configuration_size), sizeof(configuration_size));
+  }
+  const auto third_run = run(44);
+  CG_TEST_EQUIV(third_run.first, first_run.first, "cross section recomputed after cache corruption");
+  const auto fourth_run = run(45);
+  CG_TEST_EQUAL(third_run.first, fourth_run.first, "corrupted cache file overwritten");
+
+  fs::remove_all(cache_path);
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,66 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CepGen/Core/RunParameters.h"
+#include "CepGen/Event/Event.h"
+#include "CepGen/EventFilter/EventExporter.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  string input_card;
+  int num_events, num_threads;
+
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("config,i", "path to the configuration file", &input_card, "Cards/lpair_cfg.py")
+      .addOptionalArgument("num-events,n", "number of events to generate", &num_events, 10)
+      .addOptionalArgument("num-threads,t", "number of threads to use for grid preparation", &num_threads, 3)
+      .parse();
+
+  // generate a few events with a fixed random numbers stream, the generation grid prepared with a given threads pool
+  const auto generate = [&](int num_preparation_threads, const string& random_generator) {
+    cepgen::Generator gen;
+    gen.parseRunParameters(input_card);
+    gen.runParameters().eventExportersSequence().clear();
+    gen.runParameters().integrator().operator[]<cepgen::ParametersList>("randomGenerator").set<unsigned long long>(
+        "seed", 42);
+    auto worker_params = gen.runParameters().generation().parameters().get<cepgen::ParametersList>("worker");
+    worker_params.set("numThreads", num_preparation_threads);
+    worker_params.set("randomGenerator",
+                      cepgen::ParametersList().setName(random_generator).set<unsigned long long>("seed", 42));
+    gen.runParameters().generation().setParameters(cepgen::ParametersList().set("worker", worker_params));
+    vector<double> weights;
+    gen.generate(num_events, [&weights](const cepgen::Event& event, size_t) {
+      weights.emplace_back(event.metadata(cepgen::Event::EventMetadata::Weight));
+    });
+    return weights;
+  };
+
+  for (const auto& random_generator : {"stl", "philox"}) {
+    const auto single_thread_weights = generate(1, random_generator),
+               multi_threads_weights = generate(num_threads, random_generator);
+    CG_TEST_EQUAL(single_thread_weights.size(), (size_t)num_events, "number of events generated");
+    CG_TEST(single_thread_weights == multi_threads_weights,
+            "events independent of the grid preparation threads ("s + random_generator + " engine)");
+  }
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,95 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <future>
+
+#include "CepGen/FormFactors/Parameterisation.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/FormFactorsFactory.h"
+#include "CepGen/Modules/StructureFunctionsFactory.h"
+#include "CepGen/StructureFunctions/Parameterisation.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  vector<string> str_funs;
+  string form_factors;
+  int num_threads;
+
+  cepgen::initialise();
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("str-funs,s",
+                           "structure functions modellings",
+                           &str_funs,
+                           vector<string>{"SuriYennie", "ALLM97", "ChristyBosted", "LUXLike"})
+      .addOptionalArgument("form-factors,f", "form factors modelling", &form_factors, "StandardDipole")
+      .addOptionalArgument("num-threads,t", "number of concurrent evaluation threads", &num_threads, 4)
+      .parse();
+
+  vector<pair<double, double> > points;
+  for (const auto& xbj : {1.e-4, 3.14e-3, 0.0421, 0.1234, 0.3456, 0.789})
+    for (const auto& q2 : {2.1e-3, 0.0765, 1.2345, 4.321, 56.78})
+      points.emplace_back(xbj, q2);
+
+  for (const auto& str_fun : str_funs) {
+    auto sf = cepgen::StructureFunctionsFactory::get().build(str_fun);
+    vector<double> f2_ref, fl_ref, w2_ref;
+    for (const auto& [xbj, q2] : points)
+      f2_ref.emplace_back(sf->F2(xbj, q2)), fl_ref.emplace_back(sf->FL(xbj, q2)), w2_ref.emplace_back(sf->W2(xbj, q2));
+    // all threads share a single instance, and scan the points in different orders
+    vector<future<size_t> > jobs;
+    for (int i = 0; i < num_threads; ++i)
+      jobs.emplace_back(async(launch::async, [&sf, &points, &f2_ref, &fl_ref, &w2_ref, i]() {
+        size_t num_identical = 0;
+        for (size_t j = 0; j < 100 * points.size(); ++j) {
+          const auto id = (j * 7 + i) % points.size();
+          const auto vals = sf->evaluate({points.at(id).first, points.at(id).second});
+          num_identical += vals.f2 == f2_ref.at(id) && vals.fl == fl_ref.at(id) && vals.w2 == w2_ref.at(id);
+        }
+        return num_identical;
+      }));
+    size_t num_identical = 0;
+    for (auto& job : jobs)
+      num_identical += job.get();
+    CG_TEST_EQUAL(num_identical, 100 * num_threads * points.size(), str_fun + " concurrent evaluations");
+  }
+  {
+    auto ff = cepgen::FormFactorsFactory::get().build(form_factors);
+    vector<double> ge_ref;
+    for (const auto& point : points)
+      ge_ref.emplace_back((*ff)(point.second).GE);
+    vector<future<size_t> > jobs;
+    for (int i = 0; i < num_threads; ++i)
+      jobs.emplace_back(async(launch::async, [&ff, &points, &ge_ref, i]() {
+        size_t num_identical = 0;
+        for (size_t j = 0; j < 100 * points.size(); ++j) {
+          const auto id = (j * 7 + i) % points.size();
+          num_identical += ff->evaluate(points.at(id).second).GE == ge_ref.at(id);
+        }
+        return num_identical;
+      }));
+    size_t num_identical = 0;
+    for (auto& job : jobs)
+      num_identical += job.get();
+    CG_TEST_EQUAL(num_identical, 100 * num_threads * points.size(), form_factors + " concurrent evaluations");
+  }
+
+  CG_TEST_SUMMARY;
+}
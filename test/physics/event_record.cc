@@ -0,0 +1,98 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+
+#include "CepGen/Event/Event.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  bool verbose;
+  cepgen::ArgumentsParser(argc, argv).addOptionalArgument("verbose,v", "verbose mode", &verbose, false).parse();
+  CG_TEST_DEBUG(verbose);
+
+  {  // parentage identifiers set, with inline storage overflowing to the heap
+    cepgen::ParticlesIds ids{5, 2, 2, 7};
+    CG_TEST_EQUAL(ids.size(), 3ul, "duplicate identifiers removal");
+    CG_TEST_EQUAL(*ids.begin(), 2, "sorted identifiers (first)");
+    CG_TEST_EQUAL(*ids.rbegin(), 7, "sorted identifiers (last)");
+    CG_TEST(!ids.insert(5).second, "insertion of an already present identifier");
+    for (const auto& id : {1, 9, 4, 8, 3})
+      ids.insert(id);
+    CG_TEST_EQUAL(ids.size(), 8ul, "identifiers set size beyond inline storage");
+    CG_TEST(std::is_sorted(ids.begin(), ids.end()), "sorted identifiers beyond inline storage");
+    CG_TEST_EQUAL(ids.erase(4), 1ul, "identifier removal");
+    CG_TEST_EQUAL(ids.erase(4), 0ul, "removal of a non-present identifier");
+    CG_TEST_EQUAL(ids.count(4), 0ul, "removed identifier lookup");
+    CG_TEST_EQUAL(ids.count(9), 1ul, "present identifier lookup");
+    const auto ids_copy = ids;
+    CG_TEST(ids_copy == ids, "identifiers set copy");
+    ids.clear();
+    CG_TEST(ids.empty(), "identifiers set clearing");
+    ids.insert(3);
+    CG_TEST_EQUAL(ids.size(), 1ul, "identifiers set refilling after clearing");
+  }
+  {  // role-indexed particles table
+    auto evt = cepgen::Event::minimal(2);
+    CG_TEST_EQUAL(evt.size(), 9ul, "minimal event multiplicity");
+    CG_TEST(evt.hasRole(cepgen::Particle::Role::CentralSystem), "central system role presence");
+    CG_TEST(!evt.hasRole(cepgen::Particle::Role::UnknownRole), "unknown role absence");
+    const auto& parton1 = evt.oneWithRole(cepgen::Particle::Role::Parton1);
+    CG_TEST_EQUAL(parton1.mothers().size(), 1ul, "parton parentage multiplicity");
+    CG_TEST_EQUAL(
+        *parton1.mothers().begin(), evt.oneWithRole(cepgen::Particle::Role::IncomingBeam1).id(), "parton parentage");
+    const auto particles = evt.particles();
+    CG_TEST(std::is_sorted(particles.begin(), particles.end()), "particles list sorting");
+
+    cepgen::Event evt_copy;
+    evt_copy = evt;
+    CG_TEST(evt_copy == evt, "event copy");
+    evt_copy.clear();
+    CG_TEST(evt_copy.empty(), "event clearing");
+    evt_copy = evt;
+    CG_TEST(evt_copy == evt, "event copy after clearing");
+  }
+  {  // metadata with interned keys
+    cepgen::Event::EventMetadata metadata;
+    CG_TEST_EQUAL(metadata("weight"), 1.f, "default weight");
+    CG_TEST_EQUAL(metadata(cepgen::Event::EventMetadata::Weight), 1.f, "default weight (interned key)");
+    CG_TEST_EQUAL(cepgen::Event::EventMetadata::name(cepgen::Event::EventMetadata::TotalTime),
+                  "time:total"s,
+                  "interned key name");
+    metadata[cepgen::Event::EventMetadata::Weight] = 0.5f;
+    CG_TEST_EQUAL(metadata("weight"), 0.5f, "weight modification");
+    CG_TEST_EQUAL(metadata.count("test:nonexistent"), 0ul, "non-existent field");
+    CG_TEST_EQUAL(metadata("test:nonexistent"), -1.f, "non-existent field value");
+    metadata["test:field"] = 42.f;
+    const auto key = cepgen::Event::EventMetadata::key("test:field");
+    CG_TEST_EQUAL(metadata(key), 42.f, "user-defined field (interned key)");
+    CG_TEST_EQUAL(metadata.keys().size(), 6ul, "number of fields");
+    auto metadata_copy = metadata;
+    CG_TEST(metadata_copy == metadata, "metadata copy");
+    metadata_copy[key] = 0.f;
+    CG_TEST(metadata_copy != metadata, "metadata modification");
+    metadata.clear();
+    CG_TEST(metadata.keys().empty(), "metadata clearing");
+    CG_TEST_EQUAL(metadata("weight"), -1.f, "cleared weight");
+  }
+
+  CG_TEST_SUMMARY;
+}
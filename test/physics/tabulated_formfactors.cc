@@ -0,0 +1,69 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/FormFactors/Parameterisation.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/FormFactorsFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  string str_fun;
+  double tolerance;
+
+  cepgen::initialise();
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("str-fun,s", "structure functions modelling to integrate", &str_fun, "SuriYennie")
+      .addOptionalArgument("tolerance,t", "maximal relative deviation tolerated", &tolerance, 1.e-3)
+      .parse();
+
+  const auto params = cepgen::ParametersList()
+                          .set("structureFunctions", cepgen::ParametersList().setName(str_fun))
+                          .set("computeFM", true)
+                          .set("q2Range", cepgen::Limits{1.e-3, 1.e2});
+  auto exact =
+      cepgen::FormFactorsFactory::get().build("InelasticNucleon", cepgen::ParametersList(params).set("numQ2", 0));
+  auto tabulated =
+      cepgen::FormFactorsFactory::get().build("InelasticNucleon", cepgen::ParametersList(params).set("numQ2", 200));
+  auto tabulated_copy =
+      cepgen::FormFactorsFactory::get().build("InelasticNucleon", cepgen::ParametersList(params).set("numQ2", 200));
+
+  size_t num_points = 0, num_fe_compatible = 0, num_fm_compatible = 0, num_identical = 0;
+  for (const auto& q2 : {1.234e-3, 5.678e-3, 0.0421, 0.1234, 0.789, 3.1415, 12.34, 98.76}) {
+    const auto ff_exact = exact->evaluate(q2), ff_tabulated = tabulated->evaluate(q2);
+    num_fe_compatible += fabs(ff_tabulated.FE - ff_exact.FE) <= tolerance * fabs(ff_exact.FE);
+    num_fm_compatible += fabs(ff_tabulated.FM - ff_exact.FM) <= tolerance * fabs(ff_exact.FM);
+    num_identical += tabulated_copy->evaluate(q2).FE == ff_tabulated.FE;
+    ++num_points;
+  }
+  CG_TEST_EQUAL(num_fe_compatible, num_points, "tabulated FE values");
+  CG_TEST_EQUAL(num_fm_compatible, num_points, "tabulated FM values");
+  CG_TEST_EQUAL(num_identical, num_points, "table shared among instances");
+  CG_TEST_EQUIV(tabulated->evaluate(500.).FE, exact->evaluate(500.).FE, "integration outside table range");
+  // a single-node table is a fatal error (not testable here, as fatal exceptions stop the execution), while the
+  // smallest valid table still interpolates between its two nodes
+  const auto two_nodes =
+      cepgen::FormFactorsFactory::get().build("InelasticNucleon", cepgen::ParametersList(params).set("numQ2", 2));
+  CG_TEST(std::isfinite(two_nodes->evaluate(1.).FE), "two-nodes table");
+
+  CG_TEST_SUMMARY;
+}
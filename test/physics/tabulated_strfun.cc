@@ -0,0 +1,67 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/StructureFunctionsFactory.h"
+#include "CepGen/StructureFunctions/Parameterisation.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  string str_fun;
+  double tolerance;
+
+  cepgen::initialise();
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("str-fun,s", "structure functions modelling to tabulate", &str_fun, "SuriYennie")
+      .addOptionalArgument("tolerance,t", "maximal relative deviation tolerated", &tolerance, 1.e-2)
+      .parse();
+
+  const auto cache_path = (fs::temp_directory_path() / "cepgen_test_tabulated_strfun").string();
+  fs::remove_all(cache_path);
+  const auto tabulated_params =
+      cepgen::ParametersList()
+          .set("structureFunctions", cepgen::StructureFunctionsFactory::get().describeParameters(str_fun).parameters())
+          .set("cachePath", cache_path);
+  auto exact = cepgen::StructureFunctionsFactory::get().build(str_fun);
+  auto tabulated = cepgen::StructureFunctionsFactory::get().build("Tabulated", tabulated_params);
+  CG_TEST(!fs::is_empty(cache_path), "table stored in cache");
+  auto tabulated_cached = cepgen::StructureFunctionsFactory::get().build("Tabulated", tabulated_params);
+
+  size_t num_points = 0, num_f2_compatible = 0, num_fl_compatible = 0, num_identical = 0;
+  for (const auto& xbj : {2.345e-5, 3.14e-3, 0.0421, 0.1234, 0.3456, 0.789})
+    for (const auto& q2 : {2.1e-3, 0.0765, 1.2345, 4.321, 56.78, 999.}) {
+      const auto f2 = exact->F2(xbj, q2), fl = exact->FL(xbj, q2);
+      num_f2_compatible += fabs(tabulated->F2(xbj, q2) - f2) <= tolerance * fabs(f2);
+      num_fl_compatible += fabs(tabulated->FL(xbj, q2) - fl) <= tolerance * fabs(f2);
+      num_identical += tabulated->F2(xbj, q2) == tabulated_cached->F2(xbj, q2);
+      ++num_points;
+    }
+  CG_TEST_EQUAL(num_f2_compatible, num_points, "tabulated F2 values");
+  CG_TEST_EQUAL(num_fl_compatible, num_points, "tabulated FL values");
+  CG_TEST_EQUAL(num_identical, num_points, "table retrieved from cache");
+  CG_TEST_EQUIV(tabulated->F2(1.e-7, 10.), exact->F2(1.e-7, 10.), "original modelling outside table range");
+  fs::remove_all(cache_path);
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,70 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/RandomGeneratorFactory.h"
+#include "CepGen/Utils/AliasTable.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/RandomGenerator.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  int num_samples;
+
+  cepgen::initialise();
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("num-samples,n", "number of entries to sample", &num_samples, 1'000'000)
+      .parse();
+
+  auto rng = cepgen::RandomGeneratorFactory::get().build("stl", cepgen::ParametersList().set("seed", 42ull));
+  // compare the sampled frequencies with the expected probabilities, within 5 standard deviations
+  const auto check_frequencies = [&rng, &num_samples](const cepgen::utils::AliasTable& table, const string& name) {
+    vector<size_t> counts(table.size(), 0);
+    for (int i = 0; i < num_samples; ++i)
+      counts.at(table.sample(*rng))++;
+    size_t num_compatible = 0;
+    for (size_t i = 0; i < table.size(); ++i) {
+      const auto expected = num_samples * table.probability(i);
+      num_compatible += fabs(counts.at(i) - expected) <= 5. * sqrt(expected) + 1.e-9;
+    }
+    CG_TEST_EQUAL(num_compatible, table.size(), name);
+  };
+
+  cepgen::utils::AliasTable table({1., 0., 10., 0.5, 3., 0., 100., 2.});
+  CG_TEST_EQUAL(table.size(), 8ul, "table multiplicity");
+  CG_TEST_EQUIV(table.total(), 116.5, "table normalisation");
+  check_frequencies(table, "sampled frequencies");
+
+  table.update(1, 20.);  // small increase, handled as a residual
+  CG_TEST_EQUIV(table.total(), 136.5, "table normalisation after increase");
+  check_frequencies(table, "sampled frequencies after increase");
+
+  table.update(6, 1.);  // decrease, forcing a rebuild
+  CG_TEST_EQUIV(table.probability(6), 1. / 37.5, "probability after decrease");
+  check_frequencies(table, "sampled frequencies after decrease");
+
+  for (size_t i = 0; i < 50; ++i)  // many increases, forcing several rebuilds
+    table.update(i % table.size(), table.weight(i % table.size()) + 0.5 * i);
+  check_frequencies(table, "sampled frequencies after successive increases");
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,83 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdio>
+
+#include "CepGen/Event/Event.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/BinaryEventFile.h"
+#include "CepGen/Utils/EventUtils.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  int num_events, chunk_size;
+  string filename;
+
+  cepgen::initialise();
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("num-events,n", "number of events to store", &num_events, 100)
+      .addOptionalArgument("chunk-size,c", "number of events per chunk", &chunk_size, 7)
+      .addOptionalArgument("filename,f", "temporary binary events file", &filename, "test_binary_events.cgevt"s)
+      .parse();
+
+  auto event = cepgen::utils::generateLPAIREvent();
+  const auto cross_section = cepgen::Value{1.234, 0.056};
+  {
+    cepgen::utils::BinaryEventWriter writer(filename, chunk_size);
+    writer.setCrossSection(cross_section);
+    for (int i = 0; i < num_events; ++i) {
+      event.metadata["weight"] = i;
+      writer.write(event);
+    }
+  }
+  cepgen::utils::BinaryEventReader reader(filename);
+  CG_TEST(cepgen::utils::BinaryEventReader::isBinaryEventFile(filename), "file format identification");
+  CG_TEST_EQUAL(reader.size(), size_t(num_events), "number of events");
+  CG_TEST_EQUAL(reader.numChunks(), size_t((num_events + chunk_size - 1) / chunk_size), "number of chunks");
+  CG_TEST_EQUAL(reader.crossSection(), cross_section, "cross-section");
+
+  size_t num_valid_weights = 0;
+  for (int i = num_events - 1; i >= 0; --i)  // random access, from the last event
+    num_valid_weights += reader[i].metadata(cepgen::Event::EventMetadata::Weight) == i;
+  CG_TEST_EQUAL(num_valid_weights, size_t(num_events), "events metadata");
+
+  const auto view = reader[num_events / 2];
+  CG_TEST_EQUAL(view.size(), event.size(), "number of particles in view");
+  size_t num_valid_particles = 0;
+  for (size_t i = 0; i < view.size(); ++i) {
+    const auto& particle = event(i);
+    const auto [mothers_begin, mothers_end] = view.mothers(i);
+    num_valid_particles += view.pdgId(i) == particle.integerPdgId() && view.role(i) == particle.role() &&
+                           view.status(i) == static_cast<int>(particle.status()) &&
+                           view.momentum(i) == particle.momentum() &&
+                           size_t(mothers_end - mothers_begin) == particle.mothers().size();
+  }
+  CG_TEST_EQUAL(num_valid_particles, event.size(), "particles content in view");
+
+  cepgen::Event event_in;
+  reader[num_events - 1].fill(event_in);
+  CG_TEST_EQUAL(event_in.size(), event.size(), "number of particles in filled event");
+  CG_TEST(event_in.particles() == event.particles(), "particles content in filled event");
+  CG_TEST(event_in.metadata == event.metadata, "metadata in filled event");
+
+  remove(filename.data());
+  CG_TEST_SUMMARY;
+}
@@ -42,5 +42,21 @@ int main(int argc, char* argv[]) {
   const cepgen::utils::EventBrowser bws;
   for (const auto& [variable_name, value] : values)
     CG_TEST_EQUIV(bws.get(evt, variable_name), value, variable_name);
+
+  vector<string> variables_names;
+  for (const auto& variable : values)
+    variables_names.emplace_back(variable.first);
+  const auto accessors = bws.compile(variables_names);
+  for (size_t i = 0; i < accessors.size(); ++i)
+    CG_TEST_EQUIV(accessors.at(i)(evt), values.at(i).second, "compiled " + accessors.at(i).name());
+
+  const vector<cepgen::Event> events(3, evt);
+  vector<double> batch_values;
+  cepgen::utils::EventBrowser::get(events, accessors, batch_values);
+  CG_TEST_EQUAL(batch_values.size(), events.size() * accessors.size(), "batch evaluation multiplicity");
+  for (size_t i = 0; i < batch_values.size(); ++i)
+    CG_TEST_EQUIV(batch_values.at(i),
+                  values.at(i % accessors.size()).second,
+                  "batch-evaluated " + accessors.at(i % accessors.size()).name());
   CG_TEST_SUMMARY;
 }
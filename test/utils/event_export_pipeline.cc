@@ -0,0 +1,91 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <thread>
+
+#include "CepGen/Event/Event.h"
+#include "CepGen/EventFilter/EventExportPipeline.h"
+#include "CepGen/EventFilter/EventExporter.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+/// Dummy exporter recording the weights of all events it receives, with an optional processing delay
+class WeightsRecorder final : public cepgen::EventExporter {
+public:
+  explicit WeightsRecorder(int delay_us) : EventExporter(cepgen::ParametersList()), delay_us_(delay_us) {}
+  bool operator<<(const cepgen::Event& event) override {
+    if (delay_us_ > 0)
+      this_thread::sleep_for(chrono::microseconds(delay_us_));
+    weights.emplace_back(event.metadata(cepgen::Event::EventMetadata::Weight));
+    return true;
+  }
+  vector<double> weights;
+
+private:
+  const int delay_us_;
+};
+
+int main(int argc, char* argv[]) {
+  int num_events, buffer_size;
+
+  cepgen::initialise();
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("num-events,n", "number of events to export", &num_events, 1000)
+      .addOptionalArgument("buffer-size,b", "number of events buffered", &buffer_size, 16)
+      .parse();
+
+  auto event = cepgen::Event::minimal(2);
+  WeightsRecorder fast_exporter(0), slow_exporter(10);
+  {  // blocking policy: all events are exported, in the generation order, by all exporters
+    cepgen::EventExportPipeline pipeline({&fast_exporter, &slow_exporter}, buffer_size);
+    for (int i = 0; i < num_events; ++i) {
+      event.metadata[cepgen::Event::EventMetadata::Weight] = i;
+      pipeline.push(event);
+    }
+    pipeline.flush();
+    CG_TEST_EQUAL(pipeline.numQueued(), static_cast<size_t>(num_events), "queued events multiplicity");
+    CG_TEST_EQUAL(pipeline.numDropped(), 0ul, "no events dropped with a blocking policy");
+  }
+  for (const auto* exporter : {&fast_exporter, &slow_exporter}) {
+    bool ordered = exporter->weights.size() == static_cast<size_t>(num_events);
+    for (size_t i = 0; ordered && i < exporter->weights.size(); ++i)
+      ordered = exporter->weights.at(i) == i;
+    CG_TEST(ordered,
+            "events exported in order, with a " + to_string(exporter == &slow_exporter ? 10 : 0) + " us delay");
+  }
+
+  WeightsRecorder slowest_exporter(1000);
+  {  // dropping policy: the generation is never stalled by the slow exporter
+    cepgen::EventExportPipeline pipeline(
+        {&slowest_exporter}, buffer_size, cepgen::EventExportPipeline::Backpressure::drop);
+    for (int i = 0; i < num_events; ++i)
+      pipeline.push(event);
+    const auto num_dropped = pipeline.numDropped();
+    CG_TEST(num_dropped > 0, "events dropped with a dropping policy");
+    pipeline.flush();
+    CG_TEST_EQUAL(slowest_exporter.weights.size() + num_dropped,
+                  static_cast<size_t>(num_events),
+                  "exported and dropped events multiplicity");
+  }
+
+  CG_TEST_SUMMARY;
+}
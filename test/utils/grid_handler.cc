@@ -0,0 +1,123 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/Generator.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/GridHandler.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  int num_nodes;
+
+  cepgen::initialise();
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("num-nodes,n", "number of nodes along each dimension", &num_nodes, 12)
+      .parse();
+
+  // trilinear function, exactly interpolated by both the multilinear and the Catmull-Rom kernels
+  const auto linear = [](double x, double y, double z) { return 1. + 2. * x - 3. * y + 0.5 * z; };
+  // cubic polynomial (along each dimension), better approximated by a cubic kernel than by a multilinear one
+  const auto cubic = [](double x, double y, double z) { return x * x * x - 2. * y * y * z + y * z * z * z + 4. * x; };
+
+  cepgen::GridHandler<3, 1> linear_grid(cepgen::GridType::linear), linear_cubic_grid(cepgen::GridType::linear);
+  cepgen::GridHandler<3, 1> cubic_linear_grid(cepgen::GridType::linear, cepgen::GridKernel::cubic);
+  cepgen::GridHandler<3, 1> cubic_grid(cepgen::GridType::linear, cepgen::GridKernel::cubic);
+  for (int i = 0; i < num_nodes; ++i)
+    for (int j = 0; j < num_nodes; ++j)
+      for (int k = 0; k < num_nodes / 2; ++k) {
+        // equally-spaced first and last coordinates, irregularly-spaced second coordinate
+        const double x = -1. + 2. * i / (num_nodes - 1), y = std::pow(1. * j / (num_nodes - 1), 2), z = 0.5 * k;
+        linear_grid.insert({x, y, z}, {linear(x, y, z)});
+        linear_cubic_grid.insert({x, y, z}, {cubic(x, y, z)});
+        cubic_linear_grid.insert({x, y, z}, {linear(x, y, z)});
+        cubic_grid.insert({x, y, z}, {cubic(x, y, z)});
+      }
+  for (auto* grid : {&linear_grid, &linear_cubic_grid, &cubic_linear_grid, &cubic_grid})
+    grid->initialise();
+
+  vector<cepgen::GridHandler<3, 1>::coord_t> coords;
+  for (double x = -0.987; x < 1.; x += 0.1234)
+    for (double y = 0.0123; y < 1.; y += 0.0987)
+      for (double z = 0.0345; z < 0.5 * (num_nodes / 2 - 1); z += 0.345)
+        coords.push_back({x, y, z});
+  double max_linear_deviation = 0., max_cubic_linear_deviation = 0.;
+  double sum_linear_cubic_deviation = 0., sum_cubic_deviation = 0.;
+  for (const auto& coord : coords) {
+    const auto linear_value = linear(coord.at(0), coord.at(1), coord.at(2)),
+               cubic_value = cubic(coord.at(0), coord.at(1), coord.at(2));
+    max_linear_deviation = max(max_linear_deviation, fabs(linear_grid.eval(coord)[0] - linear_value));
+    max_cubic_linear_deviation = max(max_cubic_linear_deviation, fabs(cubic_linear_grid.eval(coord)[0] - linear_value));
+    sum_linear_cubic_deviation += fabs(linear_cubic_grid.eval(coord)[0] - cubic_value);
+    sum_cubic_deviation += fabs(cubic_grid.eval(coord)[0] - cubic_value);
+  }
+  CG_TEST(max_linear_deviation < 1.e-10, "multilinear interpolation of a multilinear function");
+  CG_TEST(max_cubic_linear_deviation < 1.e-10, "cubic interpolation of a multilinear function");
+  CG_TEST(sum_cubic_deviation < 0.5 * sum_linear_cubic_deviation, "cubic interpolation of a cubic polynomial");
+
+  vector<cepgen::GridHandler<3, 1>::values_t> batch_values;
+  cubic_grid.evalBatch(coords, batch_values);
+  size_t num_identical = 0;
+  for (size_t i = 0; i < coords.size(); ++i)
+    num_identical += batch_values.at(i) == cubic_grid.eval(coords.at(i));
+  CG_TEST_EQUAL(num_identical, coords.size(), "batch evaluation");
+
+  CG_TEST_EQUAL(linear_grid.eval({-5., 0.5, 1.})[0], linear_grid.eval({-1., 0.5, 1.})[0], "clamping below boundaries");
+  CG_TEST_EQUAL(linear_grid.eval({0.5, 5., 1.})[0], linear_grid.eval({0.5, 1., 1.})[0], "clamping above boundaries");
+
+  cepgen::GridHandler<2, 2> grid_2d(cepgen::GridType::logarithmic, cepgen::GridKernel::cubic);
+  for (int i = 0; i < num_nodes; ++i)
+    for (int j = 0; j < num_nodes; ++j) {
+      const auto x = pow(10., -3. + 3. * i / (num_nodes - 1)), y = pow(10., 2. * j / (num_nodes - 1));
+      grid_2d.insert({x, y}, {log10(x) * log10(y), log10(x) + log10(y)});
+    }
+  grid_2d.initialise();
+  const auto vals_2d = grid_2d.eval({0.0123, 4.56});
+  CG_TEST_EQUIV(vals_2d[0], log10(0.0123) * log10(4.56), "logarithmic grid interpolation (first value)");
+  CG_TEST_EQUIV(vals_2d[1], log10(0.0123) + log10(4.56), "logarithmic grid interpolation (second value)");
+
+  {  // pre-indexed binary grid files round-trip
+    const auto grid_3d_path = (fs::temp_directory_path() / "cepgen_test_grid_3d.bin").string(),
+               grid_2d_path = (fs::temp_directory_path() / "cepgen_test_grid_2d.bin").string();
+    cubic_grid.save(grid_3d_path, "test metadata");
+    grid_2d.save(grid_2d_path);
+    CG_TEST((cepgen::GridHandler<3, 1>::isBinaryGrid(grid_3d_path)), "binary grid file produced");
+    cepgen::GridHandler<3, 1> loaded_3d(cepgen::GridType::linear, cepgen::GridKernel::cubic);
+    CG_TEST_EQUAL(loaded_3d.load(grid_3d_path), "test metadata", "binary grid metadata");
+    cepgen::GridHandler<2, 2> loaded_2d(cepgen::GridType::logarithmic, cepgen::GridKernel::cubic);
+    loaded_2d.load(grid_2d_path);
+    size_t num_identical_loaded = 0;
+    for (const auto& coord : coords)
+      num_identical_loaded += loaded_3d.eval(coord) == cubic_grid.eval(coord);
+    CG_TEST_EQUAL(num_identical_loaded, coords.size(), "multi-dimensional binary grid interpolation");
+    CG_TEST(loaded_2d.eval({0.0123, 4.56}) == vals_2d, "logarithmic binary grid interpolation");
+    loaded_3d.save(grid_3d_path, "updated metadata");  // overwrite the file currently mapped by the loaded grid
+    cepgen::GridHandler<3, 1> reloaded_3d(cepgen::GridType::linear, cepgen::GridKernel::cubic);
+    CG_TEST_EQUAL(reloaded_3d.load(grid_3d_path), "updated metadata", "binary grid overwritten while mapped");
+    CG_TEST(reloaded_3d.eval(coords.front()) == loaded_3d.eval(coords.front()), "overwritten binary grid content");
+    CG_TEST(!(cepgen::GridHandler<3, 1>::isBinaryGrid(__FILE__)), "non-grid file not identified as a binary grid");
+    fs::remove(grid_3d_path);
+    fs::remove(grid_2d_path);
+  }
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,74 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CepGen/Generator.h"
+#include "CepGen/Integration/GridParameters.h"
+#include "CepGen/Modules/RandomGeneratorFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/RandomGenerator.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  int bin_size, num_dimensions, num_points;
+
+  cepgen::initialise();
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("bin-size,b", "number of bins per dimension", &bin_size, 5)
+      .addOptionalArgument("num-dimensions,d", "phase space dimension", &num_dimensions, 8)
+      .addOptionalArgument("num-points,n", "number of points to shoot per bin", &num_points, 10)
+      .parse();
+
+  const cepgen::GridParameters grid(bin_size, num_dimensions);
+  size_t expected_size = 1;
+  for (int i = 0; i < num_dimensions; ++i)
+    expected_size *= bin_size;
+  CG_TEST_EQUAL(grid.size(), expected_size, "grid multiplicity");
+  CG_TEST_EQUAL(grid.numDimensions(), static_cast<size_t>(num_dimensions), "grid dimension");
+  CG_TEST_EQUAL(grid.maxValues().size(), expected_size, "maxima multiplicity");
+
+  auto rng = cepgen::RandomGeneratorFactory::get().build("stl", cepgen::ParametersList().set("seed", 42ull));
+  size_t num_valid_coordinates = 0, num_valid_points = 0;
+  vector<double> points;
+  for (size_t bin = 0; bin < grid.size(); bin += 97) {
+    // flat bin index is recovered from its coordinates
+    const auto coord = grid.n(bin);
+    size_t index = 0;
+    for (auto it = coord.rbegin(); it != coord.rend(); ++it)
+      index = index * bin_size + *it;
+    num_valid_coordinates += index == bin;
+    // all points shot lie within the bin boundaries
+    grid.shoot(*rng, bin, num_points, points);
+    bool valid = points.size() == coord.size() * num_points;
+    for (size_t i = 0; i < points.size(); ++i) {
+      const auto x = points.at(i) * bin_size, low = 1. * coord.at(i % coord.size());
+      valid &= x >= low && x <= low + 1.;
+    }
+    num_valid_points += valid;
+  }
+  const auto num_tested = (grid.size() + 96) / 97;
+  CG_TEST_EQUAL(num_valid_coordinates, num_tested, "bins coordinates decoding");
+  CG_TEST_EQUAL(num_valid_points, num_tested, "points shot within bins");
+
+  // grids up to the memory budget are accepted (larger ones are a fatal error)
+  const cepgen::GridParameters tight_grid(bin_size, num_dimensions, expected_size * cepgen::GridParameters::kBinMemory);
+  CG_TEST_EQUAL(tight_grid.size(), expected_size, "grid within the memory budget");
+
+  CG_TEST_SUMMARY;
+}
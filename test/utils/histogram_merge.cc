@@ -0,0 +1,106 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <thread>
+
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/RandomGeneratorFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Histogram.h"
+#include "CepGen/Utils/RandomGenerator.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  int num_samples, num_threads;
+
+  cepgen::initialise();
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("num-samples,n", "number of entries to fill per thread", &num_samples, 100'000)
+      .addOptionalArgument("num-threads,t", "number of filling threads", &num_threads, 4)
+      .parse();
+
+  // generate one reproducible sample per thread, covering the histograms ranges and their vicinity
+  vector<vector<pair<double, double> > > samples(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    auto rng = cepgen::RandomGeneratorFactory::get().build("stl", cepgen::ParametersList().set("seed", 42ull + i));
+    for (int j = 0; j < num_samples; ++j)
+      samples[i].emplace_back(rng->uniform(-1.5, 11.5), rng->uniform(-1.5, 11.5));
+  }
+
+  {  // arithmetic (uniform) and searched (variable) bins lookups must agree, including on the bins limits
+    cepgen::utils::Hist1D hist_uniform(10, {0., 10.}), hist_variable({0., 1., 2., 3., 4., 5., 6., 7., 8., 9., 10.});
+    for (const auto& sample : samples)
+      for (const auto& xy : sample)
+        hist_uniform.fill(xy.first), hist_variable.fill(xy.first);
+    for (double x = 0.; x <= 10.; x += 0.5)
+      hist_uniform.fill(x), hist_variable.fill(x);
+    size_t num_identical = 0;
+    for (size_t i = 0; i < hist_uniform.nbins(); ++i)
+      num_identical += hist_uniform.value(i) == hist_variable.value(i);
+    CG_TEST_EQUAL(num_identical, hist_uniform.nbins(), "uniform/variable bins contents");
+    CG_TEST_EQUAL(hist_uniform.underflow(), hist_variable.underflow(), "uniform/variable underflow");
+    CG_TEST_EQUAL(hist_uniform.overflow(), hist_variable.overflow(), "uniform/variable overflow");
+    CG_TEST_EQUAL(hist_uniform.bin(10. - 1.e-12), 9ul, "last bin lookup");
+  }
+  {  // per-thread copies merged at the end must match a serial filling
+    cepgen::utils::Hist1D hist_serial(26, {-1., 12.});
+    cepgen::utils::Hist2D hist2d_serial(13, {0., 10.}, 7, {0., 10.});
+    for (const auto& sample : samples)
+      for (const auto& xy : sample)
+        hist_serial.fill(xy.first), hist2d_serial.fill(xy.first, xy.second);
+
+    vector<cepgen::utils::Hist1D> hists(num_threads, cepgen::utils::Hist1D(26, {-1., 12.}));
+    vector<cepgen::utils::Hist2D> hists2d(num_threads, cepgen::utils::Hist2D(13, {0., 10.}, 7, {0., 10.}));
+    vector<thread> threads;
+    for (int i = 0; i < num_threads; ++i)
+      threads.emplace_back([&, i]() {
+        for (const auto& xy : samples[i])
+          hists[i].fill(xy.first), hists2d[i].fill(xy.first, xy.second);
+      });
+    for (auto& thread : threads)
+      thread.join();
+    auto hist_merged = hists.at(0);
+    auto hist2d_merged = hists2d.at(0);
+    for (int i = 1; i < num_threads; ++i)
+      hist_merged.merge(hists.at(i)), hist2d_merged.merge(hists2d.at(i));
+
+    size_t num_identical = 0;
+    for (size_t i = 0; i < hist_serial.nbins(); ++i)
+      num_identical += hist_merged.value(i) == hist_serial.value(i) &&
+                       hist_merged.value(i).uncertainty() == hist_serial.value(i).uncertainty();
+    CG_TEST_EQUAL(num_identical, hist_serial.nbins(), "merged 1D bins contents");
+    CG_TEST_EQUAL(hist_merged.underflow(), hist_serial.underflow(), "merged 1D underflow");
+    CG_TEST_EQUAL(hist_merged.overflow(), hist_serial.overflow(), "merged 1D overflow");
+    CG_TEST_EQUAL(hist_merged.integral(true), hist_serial.integral(true), "merged 1D integral");
+
+    num_identical = 0;
+    for (size_t i = 0; i < hist2d_serial.nbinsX(); ++i)
+      for (size_t j = 0; j < hist2d_serial.nbinsY(); ++j)
+        num_identical += hist2d_merged.value(i, j) == hist2d_serial.value(i, j) &&
+                         hist2d_merged.value(i, j).uncertainty() == hist2d_serial.value(i, j).uncertainty();
+    CG_TEST_EQUAL(num_identical, hist2d_serial.nbinsX() * hist2d_serial.nbinsY(), "merged 2D bins contents");
+    CG_TEST_EQUAL(hist2d_merged.outOfRange().total(), hist2d_serial.outOfRange().total(), "merged 2D out-of-range");
+    CG_TEST_EQUAL(hist2d_merged.integral(), hist2d_serial.integral(), "merged 2D integral");
+
+    CG_TEST_EXCEPT([&hist_merged]() { hist_merged.merge(cepgen::utils::Hist1D(10, {0., 1.})); },
+                   "merge of incompatible binnings");
+  }
+  CG_TEST_SUMMARY;
+}
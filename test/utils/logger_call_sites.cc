@@ -0,0 +1,68 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CepGen/Generator.h"
+#include "CepGen/Utils/Logger.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+// each function holds a single logging call site, with its own cached decision
+static bool passDebug(const char* name) { return CG_LOG_MATCH(name, debug); }
+static bool passDebugConstant() { return CG_LOG_MATCH("LoggerTest", debug); }
+static bool passWarningConstant() { return CG_LOG_MATCH("LoggerTest", warning); }
+
+int main() {
+  cepgen::initialise();
+  auto& logger = cepgen::utils::Logger::get();
+
+  logger.setLevel(cepgen::utils::Logger::Level::information);
+  CG_TEST(!passDebugConstant(), "debugging call site disabled");
+  CG_TEST(!passDebugConstant(), "debugging call site disabled (cached)");
+  CG_TEST(passWarningConstant(), "warning call site enabled");
+
+  logger.setLevel(cepgen::utils::Logger::Level::debug);
+  CG_TEST(passDebugConstant(), "debugging call site enabled after a threshold change");
+  CG_TEST(passDebug("AnyModule"), "debugging call site enabled for any module");
+
+  logger.setLevel(cepgen::utils::Logger::Level::information);
+  CG_TEST(!passDebugConstant(), "debugging call site disabled after a threshold change");
+  CG_TEST(!passDebug("AnyModule"), "debugging call site disabled for any module");
+
+  logger.addExceptionRule("Logger.*");
+  CG_TEST(passDebugConstant(), "debugging call site enabled after a rule addition");
+  CG_TEST(passDebug("LoggerTest"), "variable module name matching the rule");
+  CG_TEST(!passDebug("AnyModule"), "variable module name not matching the rule");
+  CG_TEST(passDebug("LoggerTest"), "variable module name matching the rule (not cached)");
+
+  // streamed operands of a disabled call site are never evaluated
+  int num_evaluations = 0;
+  const auto evaluate = [&num_evaluations]() { return ++num_evaluations; };
+  logger.setLevel(cepgen::utils::Logger::Level::information);
+  CG_DEBUG_LOOP("AnyModule") << "value: " << evaluate();
+  CG_DEBUG("AnyModule") << "value: " << evaluate();
+  CG_TEST_EQUAL(num_evaluations, 0, "operands of disabled call sites not evaluated");
+#ifdef CEPGEN_NO_DEBUG_LOOP
+  logger.setLevel(cepgen::utils::Logger::Level::debugInsideLoop);
+  CG_DEBUG_LOOP("AnyModule") << "value: " << evaluate();
+  CG_TEST_EQUAL(num_evaluations, 0, "operands of stripped in-loop call sites not evaluated");
+  logger.setLevel(cepgen::utils::Logger::Level::information);
+#endif
+
+  CG_TEST_SUMMARY;
+}
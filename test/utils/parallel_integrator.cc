@@ -0,0 +1,65 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/Generator.h"
+#include "CepGen/Integration/Integrator.h"
+#include "CepGen/Modules/IntegratorFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Test.h"
+#include "CepGen/Utils/Value.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  vector<string> integrators;
+  int num_threads;
+
+  cepgen::initialise();
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument(
+          "integrator,i", "type of integrator used", &integrators, vector<string>{"plain_mt", "Vegas_mt", "MISER_mt"})
+      .addOptionalArgument("num-threads,t", "number of threads to compare with", &num_threads, 4)
+      .parse();
+
+  const auto integrand = [](const vector<double>& vars) -> double {
+    return 1. / (1. - cos(vars.at(0)) * cos(vars.at(1)) * cos(vars.at(2))) / (M_PI * M_PI * M_PI);
+  };
+  const vector<cepgen::Limits> limits(3, cepgen::Limits{0., M_PI});
+
+  for (const auto& integrator_name : integrators) {
+    auto integrate = [&](int threads, int batch_size = 10'000) {
+      return cepgen::IntegratorFactory::get()
+          .build(integrator_name, cepgen::ParametersList().set("numThreads", threads).set("batchSize", batch_size))
+          ->integrate(integrand, limits);
+    };
+    const auto res_single = integrate(1), res_multi = integrate(num_threads), res_batched = integrate(num_threads, 997);
+    CG_TEST_VALUES(res_single, 1.3932039296856768591842462603255, 5., integrator_name + " single-threaded result");
+    CG_TEST_EQUAL(static_cast<double>(res_single),
+                  static_cast<double>(res_multi),
+                  integrator_name + " result independent of threads multiplicity");
+    CG_TEST_EQUAL(res_single.uncertainty(),
+                  res_multi.uncertainty(),
+                  integrator_name + " uncertainty independent of threads multiplicity");
+    CG_TEST_EQUAL(static_cast<double>(res_multi),
+                  static_cast<double>(res_batched),
+                  integrator_name + " result independent of batch size");
+  }
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,80 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/RandomGeneratorFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/RandomGenerator.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  int num_values;
+
+  cepgen::initialise();
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("num-values,n", "number of values to draw", &num_values, 100'000)
+      .parse();
+
+  const auto build = [](unsigned long long stream) {
+    return cepgen::RandomGeneratorFactory::get().build(
+        "philox", cepgen::ParametersList().set("seed", 42ull).set("stream", stream));
+  };
+
+  {  // the sequence does not depend on the partitioning of the draws
+    vector<double> batch(num_values), scalar(num_values), mixed(num_values);
+    build(0)->fillUniform(batch.data(), batch.size());
+    auto rng_scalar = build(0);
+    for (auto& value : scalar)
+      value = rng_scalar->uniform();
+    auto rng_mixed = build(0);
+    for (size_t i = 0, size = 1; i < mixed.size(); i += size, size = size % 7 + 1)
+      if (size % 2 == 0)
+        rng_mixed->fillUniform(mixed.data() + i, std::min(size, mixed.size() - i));
+      else
+        for (size_t j = i; j < std::min(i + size, mixed.size()); ++j)
+          mixed[j] = rng_mixed->uniform();
+    CG_TEST(batch == scalar, "batch and scalar draws");
+    CG_TEST(batch == mixed, "batch and mixed-size draws");
+    CG_TEST(*std::min_element(batch.begin(), batch.end()) >= 0., "lower bound");
+    CG_TEST(*std::max_element(batch.begin(), batch.end()) < 1., "upper bound");
+    CG_TEST_EQUIV(std::accumulate(batch.begin(), batch.end(), 0.) / num_values, 0.5, "mean value");
+  }
+  {  // streams are reproducible and independent
+    vector<double> stream0(num_values), stream0_again(num_values), stream1(num_values);
+    build(0)->fillUniform(stream0.data(), stream0.size());
+    build(0)->fillUniform(stream0_again.data(), stream0_again.size());
+    build(1)->fillUniform(stream1.data(), stream1.size());
+    CG_TEST(stream0 == stream0_again, "stream reproducibility");
+    double cov = 0.;
+    size_t num_equal = 0;
+    for (int i = 0; i < num_values; ++i) {
+      cov += (stream0[i] - 0.5) * (stream1[i] - 0.5);
+      num_equal += stream0[i] == stream1[i];
+    }
+    CG_TEST_EQUAL(num_equal, 0ul, "distinct streams");
+    CG_TEST(fabs(cov / num_values) < 5. / 12. / sqrt(num_values), "uncorrelated streams");
+  }
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,81 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <thread>
+
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Test.h"
+#include "CepGen/Utils/TimeKeeper.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  int num_threads, num_samples;
+  bool verbose;
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("threads,t", "number of ticking threads", &num_threads, 4)
+      .addOptionalArgument("samples,n", "number of timing samples per thread", &num_samples, 1000)
+      .addOptionalArgument("verbose,v", "verbose mode", &verbose, false)
+      .parse();
+  CG_TEST_DEBUG(verbose);
+
+  cepgen::utils::TimeKeeper tk(true);
+  CG_TEST(tk.empty(), "empty timekeeper");
+
+  // each thread ticks a uniform distribution of timings from 1 us to num_samples us
+  static constexpr double us_to_s = 1.e-6;
+  vector<thread> threads;
+  for (int i = 0; i < num_threads; ++i)
+    threads.emplace_back([&tk, &num_samples]() {
+      for (int j = 1; j <= num_samples; ++j)
+        tk.tick("uniform", j * us_to_s);
+    });
+  for (auto& thread : threads)
+    thread.join();
+  CG_TEST(!tk.empty(), "filled timekeeper");
+  CG_DEBUG("main") << tk.summary();
+
+  const auto monitors = tk.monitors();
+  CG_TEST_EQUAL(monitors.size(), 1ul, "number of monitors");
+  const auto& uniform = monitors.at("uniform");
+  CG_TEST_EQUAL(uniform.size(), static_cast<size_t>(num_threads * num_samples), "number of merged samples");
+  CG_TEST_SET_PRECISION(1.e-12);
+  CG_TEST_EQUIV(uniform.min(), us_to_s, "minimum");
+  CG_TEST_EQUIV(uniform.max(), num_samples * us_to_s, "maximum");
+  CG_TEST_EQUIV(uniform.mean(), 0.5 * (num_samples + 1) * us_to_s, "mean");
+  CG_TEST_SET_PRECISION(1.e-3);
+  CG_TEST_EQUIV(uniform.rms() / (num_samples * us_to_s), 1. / std::sqrt(12.), "normalised RMS");
+  // histogram resolution is 1/16 of a power of two
+  CG_TEST_SET_PRECISION(1. / 16);
+  CG_TEST_EQUIV(uniform.quantile(0.5) / (0.5 * num_samples * us_to_s), 1., "normalised median");
+  CG_TEST_EQUIV(uniform.quantile(0.99) / (0.99 * num_samples * us_to_s), 1., "normalised 99th percentile");
+
+  cepgen::utils::TimeKeeper tk2;
+  tk2.tick("uniform", us_to_s).tick("other", us_to_s);
+  tk.merge(tk2);
+  CG_TEST_EQUAL(tk.monitors().size(), 2ul, "number of monitors after merging");
+  CG_TEST_EQUAL(tk.monitors().at("uniform").size(),
+                static_cast<size_t>(num_threads * num_samples + 1),
+                "number of samples after merging");
+
+  tk.clear();
+  CG_TEST(tk.empty(), "cleared timekeeper");
+
+  CG_TEST_SUMMARY;
+}
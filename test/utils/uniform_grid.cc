@@ -0,0 +1,108 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/Core/ParametersDescription.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/Test.h"
+#include "CepGen/Utils/UniformGrid.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  int num_nodes;
+
+  cepgen::initialise();
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("num-nodes,n", "number of nodes along each dimension", &num_nodes, 100)
+      .parse();
+
+  const auto function = [](double x, double y) -> cepgen::UniformGrid<2, 1>::values_t {
+    return {std::sin(std::log10(x)) * std::pow(y, 0.3)};
+  };
+  cepgen::UniformGrid<2, 1> grid({cepgen::Limits{1.e-4, 1.}, cepgen::Limits{1., 1.e3}},
+                                 {static_cast<size_t>(num_nodes), static_cast<size_t>(num_nodes / 2)},
+                                 cepgen::GridType::logarithmic);
+  CG_TEST_EQUAL(grid.size(), static_cast<size_t>(num_nodes * (num_nodes / 2)), "grid multiplicity");
+  for (size_t i = 0; i < grid.size(); ++i) {
+    const auto node = grid.node(i);
+    grid.setValue(i, function(node[0], node[1]));
+  }
+  CG_TEST_EQUIV(grid.node(0)[0], 1.e-4, "first node coordinate");
+  CG_TEST_EQUIV(grid.node(grid.size() - 1)[1], 1.e3, "last node coordinate");
+
+  size_t num_exact_nodes = 0;
+  for (size_t i = 0; i < grid.size(); i += 13) {
+    const auto node = grid.node(i);
+    num_exact_nodes += std::fabs(grid.eval(node)[0] - grid.value(i)[0]) < 1.e-10;
+  }
+  CG_TEST_EQUAL(num_exact_nodes, (grid.size() + 12) / 13, "interpolation exact on nodes");
+
+  double max_deviation = 0.;
+  for (double lx = -3.95; lx < 0.; lx += 0.0731)
+    for (double ly = 0.02; ly < 3.; ly += 0.0917) {
+      const auto x = std::pow(10., lx), y = std::pow(10., ly);
+      max_deviation = std::max(max_deviation, std::fabs(grid.eval({x, y})[0] - function(x, y)[0]));
+    }
+  CG_TEST(max_deviation < 1.e-3, "bicubic interpolation accuracy");
+
+  const auto serialised = grid.serialise();
+  cepgen::UniformGrid<2, 1> grid_copy(grid.ranges(), grid.numNodes(), cepgen::GridType::logarithmic);
+  CG_TEST(grid_copy.deserialise(serialised), "grid deserialisation");
+  CG_TEST_EQUAL(grid_copy.eval({0.01, 42.})[0], grid.eval({0.01, 42.})[0], "deserialised grid interpolation");
+  CG_TEST(!grid.contains({1.e-5, 10.}), "coordinates outside the grid boundaries");
+
+  cepgen::UniformGrid<2, 1> threaded_grid(grid.ranges(), grid.numNodes(), cepgen::GridType::logarithmic);
+  size_t num_builds = 0;
+  const auto num_threads = threaded_grid.fill(
+      [&function, &num_builds]() {
+        ++num_builds;
+        return [&function](const auto& coord) { return function(coord[0], coord[1]); };
+      },
+      4);
+  CG_TEST_EQUAL(num_threads, 4ul, "number of filling threads");
+  CG_TEST_EQUAL(num_builds, num_threads, "one function built per filling thread");
+  CG_TEST(threaded_grid.serialise() == serialised, "threaded grid filling");
+  const auto deviation =
+      threaded_grid.maxRelativeDeviation([&function](const auto& coord) { return function(coord[0], coord[1]); }, 100);
+  CG_TEST(deviation[0] > 0. && deviation[0] < 1.e-2, "maximal relative deviation at cells centres");
+
+  const auto cache_path = (fs::temp_directory_path() / "cepgen_test_uniform_grid").string();
+  fs::remove_all(cache_path);
+  const auto caching_params =
+      cepgen::UniformGrid<2, 1>::cachingDescription(10, 1.e-2).parameters().set("cachePath", cache_path);
+  size_t num_cached_builds = 0;
+  const auto counting_builder = [&function, &num_cached_builds]() -> cepgen::UniformGrid<2, 1>::Function {
+    ++num_cached_builds;
+    return [&function](const auto& coord) { return function(coord[0], coord[1]); };
+  };
+  cepgen::UniformGrid<2, 1> cached_grid(grid.ranges(), grid.numNodes(), cepgen::GridType::logarithmic);
+  cached_grid.buildCached("test", "configuration", counting_builder, caching_params);
+  CG_TEST(cached_grid.serialise() == serialised, "grid filled when no cache is found");
+  const auto num_filling_builds = num_cached_builds;
+  cepgen::UniformGrid<2, 1> retrieved_grid(grid.ranges(), grid.numNodes(), cepgen::GridType::logarithmic);
+  retrieved_grid.buildCached("test", "configuration", counting_builder, caching_params);
+  CG_TEST_EQUAL(num_cached_builds, num_filling_builds, "no function built for a cached grid");
+  CG_TEST(retrieved_grid.serialise() == serialised, "grid retrieved from cache");
+  fs::remove_all(cache_path);
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,87 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/Generator.h"
+#include "CepGen/Integration/VegasGrid.h"
+#include "CepGen/Modules/RandomGeneratorFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/RandomGenerator.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  int num_bins, num_points;
+
+  cepgen::initialise();
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("num-bins,b", "number of grid bins per dimension", &num_bins, 50)
+      .addOptionalArgument("num-points,n", "number of points to map", &num_points, 1000)
+      .parse();
+
+  const size_t ndim = 3, bins = num_bins, npoints = num_points;
+  // build a non-uniform grid, with bin edges following x^(j+1) along dimension j
+  vector<double> grid((bins + 1) * ndim);
+  for (size_t k = 0; k <= bins; ++k)
+    for (size_t j = 0; j < ndim; ++j)
+      grid[k * ndim + j] = pow(1. * k / bins, j + 1.);
+
+  auto rng = cepgen::RandomGeneratorFactory::get().build("stl", cepgen::ParametersList().set("seed", 42ull));
+  vector<double> points(npoints * ndim);
+  rng->fillUniform(points);
+  points.back() = 1.;  // upper edge of the hypercube
+  {  // check the batch generation against the single-value one
+    auto rng_ref = cepgen::RandomGeneratorFactory::get().build("stl", cepgen::ParametersList().set("seed", 42ull));
+    size_t num_matching = 0;
+    for (size_t i = 0; i < points.size() - 1; ++i)
+      num_matching += rng_ref->uniform() == points[i];
+    CG_TEST_EQUAL(num_matching, points.size() - 1, "batch uniform generation sequence");
+    vector<double> values(npoints);
+    rng->fillUniform(values, -2., 3.);
+    CG_TEST(*min_element(values.begin(), values.end()) >= -2. && *max_element(values.begin(), values.end()) < 3.,
+            "batch uniform generation range");
+  }
+
+  vector<double> treated_points, jacobians;
+  cepgen::vegas::treat(grid.data(), bins, ndim, points, treated_points, jacobians);
+  CG_TEST_EQUAL(treated_points.size(), points.size(), "treated points multiplicity");
+  CG_TEST_EQUAL(jacobians.size(), npoints, "jacobians multiplicity");
+
+  // scalar, point-major reference implementation
+  size_t num_matching_points = 0, num_matching_jacobians = 0;
+  for (size_t i = 0; i < npoints; ++i) {
+    double jacobian = 1.;
+    bool match = true;
+    for (size_t j = 0; j < ndim; ++j) {
+      const auto z = points[i * ndim + j] * bins;
+      const auto k = min(static_cast<size_t>(z), bins - 1);
+      const auto low = grid[k * ndim + j], width = grid[(k + 1) * ndim + j] - low;
+      match &= fabs(treated_points[i * ndim + j] - (low + width * (z - k))) < 1.e-12;
+      jacobian *= width * bins;
+    }
+    num_matching_points += match;
+    num_matching_jacobians += fabs(jacobians[i] - jacobian) <= 1.e-12 * jacobian;
+  }
+  CG_TEST_EQUAL(num_matching_points, npoints, "treated points against scalar reference");
+  CG_TEST_EQUAL(num_matching_jacobians, npoints, "jacobians against scalar reference");
+  CG_TEST_EQUAL(treated_points.back(), 1., "upper edge coordinate mapping");
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,51 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/StructureFunctionsFactory.h"
+#include "CepGen/Physics/GluonGrid.h"
+#include "CepGen/StructureFunctions/Parameterisation.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  string type, input_file, output_file;
+
+  cepgen::ArgumentsParser(argc, argv)
+      .addArgument("type,t", "type of grid to convert (mstw, kmr)", &type)
+      .addArgument("input,i", "input grid file", &input_file)
+      .addArgument("output,o", "output pre-indexed binary grid file", &output_file)
+      .parse();
+
+  cepgen::initialise();
+
+  // grids are stored in the pre-indexed binary format by their interpolators, once built
+  if (type == "mstw")
+    cepgen::StructureFunctionsFactory::get().build(
+        "MSTWGrid", cepgen::ParametersList().set("gridPath", input_file).set("binaryOutput", output_file));
+  else if (type == "kmr")
+    kmr::GluonGrid::get(cepgen::ParametersList().set("path", input_file).set("binaryOutput", output_file));
+  else
+    throw CG_FATAL("main") << "Unsupported grid type: '" << type << "'.";
+
+  CG_LOG << "Successfully converted the " << type << " grid '" << input_file << "' into '" << output_file << "'.";
+
+  return 0;
+}